@@ -0,0 +1,102 @@
+/*! \file
+ *  Allocation_Counter class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+#include "libraries.h"
+#include <atomic>
+#include <cstdlib>
+
+/*! Environment variable that keeps allocation counting on for the whole process (any value but "0") */
+const char* const COUNT_ALLOCATIONS_VARIABLE = "FDS_COUNT_ALLOCATIONS";
+
+/*! What an `Allocation_Scope` measured of the storage allocated by `Vector` (and so by every matrix) */
+struct Allocation_Stats {
+    long long allocations;      //!< blocks allocated
+    long long allocated_bytes;  //!< bytes allocated, frees not subtracted
+    long long peak_bytes;       //!< high-water mark of the live bytes, above the live bytes at the start
+    long long net_bytes;        //!< live bytes now, less the live bytes at the start
+};
+
+/*! Process-wide counters of the storage allocated by `Vector`
+ *
+ *  Counting costs a few atomic operations per allocation, so it is only on while an
+ *  `Allocation_Scope` is alive or COUNT_ALLOCATIONS_VARIABLE is set. Blocks freed while
+ *  counting that were allocated before it can take the live bytes below zero; scopes only
+ *  report differences, so that does not affect them.
+ */
+class Allocation_Counter {
+    private:
+        bool m_always;
+        std::atomic<int> m_scopes;
+        std::atomic<long long> m_allocations;
+        std::atomic<long long> m_allocated_bytes;
+        std::atomic<long long> m_live_bytes;
+        std::atomic<long long> m_peak_bytes;
+
+        friend class Allocation_Scope;
+
+    public:
+        /*! Constructs a counter with every counter zero
+         *
+         *  \param always whether to count with no scope alive
+         */
+        explicit Allocation_Counter(const bool& always);
+
+        Allocation_Counter(const Allocation_Counter&) = delete;
+        Allocation_Counter& operator=(const Allocation_Counter&) = delete;
+
+        /*! Whether allocations are being counted */
+        bool is_counting() const { return m_always || m_scopes.load(std::memory_order_relaxed) > 0; }
+
+        /*! Records an allocation of bytes, raising the high-water mark if needed */
+        void record_allocation(const size_t& bytes);
+
+        /*! Records a free of bytes */
+        void record_free(const size_t& bytes);
+
+        /*! Gets the counters since the process started counting (peak_bytes and net_bytes are the
+         *  high-water mark and the live bytes)
+         */
+        Allocation_Stats get_stats() const;
+};
+
+/*! Gets the allocation counter shared by the library
+ * \relatesalso Allocation_Counter
+ */
+Allocation_Counter& allocation_counter();
+
+/*! Counts `Vector` allocations from construction until destruction
+ *
+ *  Scopes that overlap (nested, or on other threads) share one high-water mark: the peak a scope
+ *  reports is taken since the oldest scope alive when it started, so it is exact for scopes that
+ *  run alone and an upper bound otherwise.
+ */
+class Allocation_Scope {
+    private:
+        long long m_allocations;
+        long long m_allocated_bytes;
+        long long m_live_bytes;
+
+    public:
+        /*! Starts counting
+         *
+         *  \post allocations are counted until this scope is destroyed
+         */
+        Allocation_Scope();
+
+        Allocation_Scope(const Allocation_Scope&) = delete;
+        Allocation_Scope& operator=(const Allocation_Scope&) = delete;
+
+        /*! Stops counting (unless other scopes are alive) */
+        ~Allocation_Scope();
+
+        /*! Gets what was allocated since this scope started */
+        Allocation_Stats get_stats() const;
+};
+
+#include "allocation_counter.hpp"
+#endif
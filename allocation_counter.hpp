@@ -0,0 +1,62 @@
+/*! \file
+ *  Function definitions for the `Allocation_Counter` and `Allocation_Scope` classes.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline Allocation_Counter::Allocation_Counter(const bool& always)
+    : m_always(always), m_scopes(0), m_allocations(0), m_allocated_bytes(0), m_live_bytes(0), m_peak_bytes(0) {}
+
+inline void Allocation_Counter::record_allocation(const size_t& bytes) {
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_allocated_bytes.fetch_add((long long)bytes, std::memory_order_relaxed);
+    long long live = m_live_bytes.fetch_add((long long)bytes, std::memory_order_relaxed) + (long long)bytes;
+
+    // Raise the high-water mark unless another thread already raised it past live
+    long long peak = m_peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !m_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+    return;
+}
+
+inline void Allocation_Counter::record_free(const size_t& bytes) {
+    m_live_bytes.fetch_sub((long long)bytes, std::memory_order_relaxed);
+
+    return;
+}
+
+inline Allocation_Stats Allocation_Counter::get_stats() const {
+    Allocation_Stats stats = { m_allocations.load(), m_allocated_bytes.load(), m_peak_bytes.load(), m_live_bytes.load() };
+
+    return stats;
+}
+
+inline Allocation_Counter& allocation_counter() {
+    static Allocation_Counter counter(getenv(COUNT_ALLOCATIONS_VARIABLE) != nullptr && string(getenv(COUNT_ALLOCATIONS_VARIABLE)) != "0");
+
+    return counter;
+}
+
+inline Allocation_Scope::Allocation_Scope() {
+    Allocation_Counter& counter = allocation_counter();
+
+    // The first scope alive restarts the high-water mark from the current live bytes
+    if (counter.m_scopes.fetch_add(1) == 0) { counter.m_peak_bytes.store(counter.m_live_bytes.load()); }
+    m_allocations = counter.m_allocations.load();
+    m_allocated_bytes = counter.m_allocated_bytes.load();
+    m_live_bytes = counter.m_live_bytes.load();
+}
+
+inline Allocation_Scope::~Allocation_Scope() {
+    allocation_counter().m_scopes.fetch_sub(1);
+}
+
+inline Allocation_Stats Allocation_Scope::get_stats() const {
+    const Allocation_Counter& counter = allocation_counter();
+    Allocation_Stats stats = { counter.m_allocations.load() - m_allocations,
+                               counter.m_allocated_bytes.load() - m_allocated_bytes,
+                               max(counter.m_peak_bytes.load() - m_live_bytes, 0LL),
+                               counter.m_live_bytes.load() - m_live_bytes };
+
+    return stats;
+}
@@ -0,0 +1,334 @@
+/*! benchmark.cpp
+ *
+ * Desc:
+ *      Phase-level benchmark of the finite difference solver. Every configuration is solved
+ *      repeatedly (after warm-up runs) and the assembly, factorization, substitution, error norm
+ *      and output phases are timed separately. Min, median and 95th percentile of every phase
+ *      are reported as JSON together with a description of the machine, and with the Vector
+ *      allocations of every phase (count, bytes and high-water mark) and the peak of the solve.
+ *
+ *      Usage: benchmark [--mesh 30,60] [--strategy cholesky,gaussian] [--precision float,double,long_double]
+ *                       [--stencil 5|9] [--output text|npy] [--warmup 2] [--repeat 10] [--threads N] [--json file]
+ */
+
+// Programmers: Zachary Bahr and Jacob LeGrand
+
+#include "sweep.h"
+#include <cstdio>
+#include <sys/utsname.h>
+
+/* Boundary value problem of the driver */
+double upper(double x, double y) { return ((0 * x) + (0 * y)); }
+double lower(double x, double y) { return (sin(x) + (0 * y)); }
+double right(double x, double y) { return ((0 * x) + (0 * y)); }
+double left(double x, double y) { return ((0 * x) + sin(y)); }
+
+long double exact_eqn(long double x, long double y) {
+    return (1/sinh(M_PI)) * ((sin(x) * sinh(M_PI-y)) + (sin(y) * sinh(M_PI-x)));
+}
+
+/* Phases of a solve that are timed separately */
+enum Bench_Phase { assembly_phase, factorization_phase, substitution_phase, error_norm_phase, output_phase, phase_count };
+
+const char* const PHASE_NAMES[phase_count] = { "assembly", "factorization", "substitution", "error_norm", "output" };
+
+/* What to benchmark */
+struct Bench_Options {
+    Vector<int> meshes;
+    Vector<Sweep_Strategy> strategies;
+    Vector<Precision> precisions;
+    Stencil stencil;
+    bool binary_output;
+    int warmup;
+    int repeat;
+    int threads;
+    string json_file;
+};
+
+/* Order statistics of the samples of one phase */
+struct Sample_Summary {
+    double min;
+    double median;
+    double p95;
+    double mean;
+};
+
+/* Summarizes samples (percentiles by nearest rank) */
+Sample_Summary summarize(Vector<double> samples) {
+    double* first = samples.get_ptr();
+    int count = samples.get_size();
+    sort(first, first + count);
+
+    Sample_Summary summary;
+    summary.min = first[0];
+    summary.median = (count % 2) ? first[count / 2] : (first[count / 2 - 1] + first[count / 2]) / 2;
+    summary.p95 = first[max(0, int(ceil(0.95 * count)) - 1)];
+    summary.mean = 0;
+    for (int i = 0; i < count; i++) { summary.mean += first[i] / count; }
+
+    return summary;
+}
+
+/* Solves a job once, storing the seconds spent and the allocations made in every phase; returns the error norm */
+template <typename T>
+double run_once(const Sweep_Job& job, const bool binary_output, double* seconds, Allocation_Stats* allocated) {
+    const double lower_bound = 0;
+    const double upper_bound = M_PI;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    chrono::steady_clock::time_point stop;
+    std::unique_ptr<Allocation_Scope> scope(new Allocation_Scope());
+
+    // Each phase ends where the next one starts; its scope goes before the next one starts so
+    // that the high-water mark restarts with every phase
+    auto lap = [&](const Bench_Phase& phase) {
+        stop = chrono::steady_clock::now();
+        seconds[phase] = chrono::duration<double>(stop - start).count();
+        allocated[phase] = scope->get_stats();
+        scope.reset();
+        scope.reset(new Allocation_Scope());
+        start = chrono::steady_clock::now();
+    };
+
+    Matrix_Solver<T> solver(lower_bound, upper_bound, job.mesh_length, job.strategy == gaussian_strategy, upper, lower, right, left, job.stencil);
+    lap(assembly_phase);
+
+    solver.factorize();
+    lap(factorization_phase);
+
+    Vector<T> result = solver.solve();
+    lap(substitution_phase);
+
+    Vector<T> exact_solution = gen_exact_sol<T>(lower_bound, upper_bound, job.mesh_length, &exact_eqn);
+    T norm = error_norm(lower_bound, upper_bound, job.mesh_length, result, exact_solution);
+    lap(error_norm_phase);
+
+    string file_name = binary_output ? "benchmark_output.npy" : "benchmark_output.txt";
+    if (binary_output) { write_npy(lower_bound, upper_bound, job.mesh_length, result, file_name); }
+    else { output_to_file(lower_bound, upper_bound, job.mesh_length, result, file_name); }
+    lap(output_phase);
+    remove(file_name.c_str());
+
+    return double(norm);
+}
+
+/* Runs the warm-up and measured solves of a job and appends its JSON object to `json` */
+template <typename T>
+void bench_job(const Sweep_Job& job, const Bench_Options& options, ostream& json) {
+    double seconds[phase_count];
+    Allocation_Stats allocated[phase_count];
+    double norm = 0;
+    for (int i = 0; i < options.warmup; i++) { run_once<T>(job, options.binary_output, seconds, allocated); }
+
+    Vector<Vector<double> > samples(phase_count, Vector<double>(options.repeat, 0));
+    for (int i = 0; i < options.repeat; i++) {
+        norm = run_once<T>(job, options.binary_output, seconds, allocated);
+        for (int p = 0; p < phase_count; p++) { samples[p][i] = seconds[p]; }
+    }
+
+    json << "    {\"mesh_length\": " << job.mesh_length
+         << ", \"strategy\": \"" << strategy_name(job.strategy) << "\""
+         << ", \"precision\": \"" << precision_name(job.precision) << "\""
+         << ", \"stencil\": \"" << (job.stencil == nine_point ? "9-point" : "5-point") << "\""
+         << ", \"output\": \"" << (options.binary_output ? "npy" : "text") << "\""
+         << ", \"unknowns\": " << (job.mesh_length - 1) * (job.mesh_length - 1)
+         << ", \"error_norm\": ";
+    if (std::isfinite(norm)) { json << norm; }
+    else { json << "null"; }
+
+    // Allocations are the same in every run, so the last one is reported; the peak of the solve
+    // is the largest phase peak on top of what the earlier phases left allocated
+    long long live = 0;
+    long long peak = 0;
+    for (int p = 0; p < phase_count; p++) {
+        peak = max(peak, live + allocated[p].peak_bytes);
+        live += allocated[p].net_bytes;
+    }
+    json << ", \"peak_bytes\": " << peak;
+    json << ",\n     \"phases\": {";
+
+    for (int p = 0; p < phase_count; p++) {
+        Sample_Summary summary = summarize(samples[p]);
+        json << (p ? ",\n                " : "") << "\"" << PHASE_NAMES[p] << "\": {\"min\": " << summary.min
+             << ", \"median\": " << summary.median << ", \"p95\": " << summary.p95 << ", \"mean\": " << summary.mean
+             << ", \"allocations\": " << allocated[p].allocations << ", \"allocated_bytes\": " << allocated[p].allocated_bytes
+             << ", \"peak_bytes\": " << allocated[p].peak_bytes << "}";
+    }
+    json << "}}";
+
+    cerr << "mesh " << job.mesh_length << ", " << strategy_name(job.strategy) << ", " << precision_name(job.precision)
+         << ": factorization median " << summarize(samples[factorization_phase]).median << " s, peak "
+         << peak / 1048576.0 << " MiB" << endl;
+}
+
+/* Quotes a string for JSON */
+string json_string(const string& text) {
+    string quoted = "\"";
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '"' || text[i] == '\\') { quoted += '\\'; }
+        if (static_cast<unsigned char>(text[i]) >= 0x20) { quoted += text[i]; }
+    }
+
+    return quoted + "\"";
+}
+
+/* Gets the processor model from /proc/cpuinfo ("unknown" elsewhere) */
+string cpu_model() {
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0 && line.find(':') != string::npos) {
+            return line.substr(line.find(':') + 2);
+        }
+    }
+
+    return "unknown";
+}
+
+/* Writes the machine description */
+void write_machine(ostream& json) {
+    utsname system;
+    uname(&system);
+
+    char timestamp[32];
+    time_t now = time(nullptr);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    json << "  \"machine\": {\"host\": " << json_string(system.nodename)
+         << ", \"os\": " << json_string(string(system.sysname) + " " + system.release)
+         << ", \"architecture\": " << json_string(system.machine)
+         << ", \"cpu\": " << json_string(cpu_model())
+         << ", \"hardware_threads\": " << std::thread::hardware_concurrency()
+         << ", \"threads\": " << Matrix_Solver<double>::get_num_threads()
+         << ", \"simd_lanes\": " << SIMD_LANES
+         << ", \"compiler\": " << json_string(__VERSION__)
+         << ", \"timestamp\": " << json_string(timestamp) << "},\n";
+}
+
+/* Splits a comma separated list */
+Vector<string> split_list(const string& list) {
+    Vector<string> items;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        size_t end = list.find(',', begin);
+        if (end == string::npos) { end = list.size(); }
+        items.push_back(list.substr(begin, end - begin));
+        begin = end + 1;
+    }
+
+    return items;
+}
+
+/* Reads the command line */
+Bench_Options parse_options(const int argc, char** argv) {
+    Bench_Options options;
+    options.meshes.push_back(30);
+    options.strategies.push_back(cholesky_strategy);
+    options.precisions.push_back(double_precision);
+    options.stencil = five_point;
+    options.binary_output = false;
+    options.warmup = 2;
+    options.repeat = 10;
+    options.threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        string name = argv[i];
+        if (i + 1 >= argc) { throw invalid_argument("Error: Option " + name + " needs a value."); }
+        string value = argv[++i];
+
+        if (name == "--mesh") {
+            options.meshes = Vector<int>();
+            Vector<string> items = split_list(value);
+            for (int k = 0; k < items.get_size(); k++) {
+                int mesh = atoi(items[k].c_str());
+                if (mesh <= 1) { throw invalid_argument("Error: Mesh length should be greater than 1."); }
+                options.meshes.push_back(mesh);
+            }
+        }
+        else if (name == "--strategy") {
+            options.strategies = Vector<Sweep_Strategy>();
+            Vector<string> items = split_list(value);
+            for (int k = 0; k < items.get_size(); k++) {
+                if (items[k] == "cholesky") { options.strategies.push_back(cholesky_strategy); }
+                else if (items[k] == "gaussian") { options.strategies.push_back(gaussian_strategy); }
+                else { throw invalid_argument("Error: Unknown strategy " + items[k] + "."); }
+            }
+        }
+        else if (name == "--precision") {
+            options.precisions = Vector<Precision>();
+            Vector<string> items = split_list(value);
+            for (int k = 0; k < items.get_size(); k++) {
+                if (items[k] == "float") { options.precisions.push_back(float_precision); }
+                else if (items[k] == "double") { options.precisions.push_back(double_precision); }
+                else if (items[k] == "long_double") { options.precisions.push_back(long_double_precision); }
+                else { throw invalid_argument("Error: Unknown precision " + items[k] + "."); }
+            }
+        }
+        else if (name == "--stencil") {
+            if (value != "5" && value != "9") { throw invalid_argument("Error: Stencil should be 5 or 9."); }
+            options.stencil = (value == "9") ? nine_point : five_point;
+        }
+        else if (name == "--output") {
+            if (value != "text" && value != "npy") { throw invalid_argument("Error: Output should be text or npy."); }
+            options.binary_output = (value == "npy");
+        }
+        else if (name == "--warmup") { options.warmup = max(0, atoi(value.c_str())); }
+        else if (name == "--repeat") { options.repeat = max(1, atoi(value.c_str())); }
+        else if (name == "--threads") { options.threads = max(0, atoi(value.c_str())); }
+        else if (name == "--json") { options.json_file = value; }
+        else { throw invalid_argument("Error: Unknown option " + name + "."); }
+    }
+
+    return options;
+}
+
+int main(int argc, char** argv) {
+    try {
+        Bench_Options options = parse_options(argc, argv);
+        if (options.threads > 0) { Matrix_Solver<double>::set_num_threads(options.threads); }
+
+        // Every run factors its matrix instead of reusing the previous run's factorization
+        factor_cache().set_capacity(0);
+
+        ofstream file;
+        if (!options.json_file.empty()) {
+            file.open(options.json_file);
+            if (!file) { throw runtime_error("Error: Could not open " + options.json_file + " for writing."); }
+        }
+        ostream& json = options.json_file.empty() ? cout : file;
+
+        json << setprecision(PRECISION);
+        json << "{\n";
+        write_machine(json);
+        json << "  \"warmup\": " << options.warmup << ", \"repeat\": " << options.repeat << ",\n";
+        json << "  \"results\": [\n";
+
+        bool first = true;
+        for (int m = 0; m < options.meshes.get_size(); m++) {
+            for (int s = 0; s < options.strategies.get_size(); s++) {
+                for (int p = 0; p < options.precisions.get_size(); p++) {
+                    Sweep_Job job = { options.meshes[m], options.strategies[s], options.precisions[p], options.stencil };
+                    if (!first) { json << ",\n"; }
+                    first = false;
+
+                    switch (job.precision) {
+                        case float_precision: bench_job<float>(job, options, json); break;
+                        case double_precision: bench_job<double>(job, options, json); break;
+                        default: bench_job<long double>(job, options, json); break;
+                    }
+                }
+            }
+        }
+        json << "\n  ]\n}\n";
+    }
+    catch(const invalid_argument& err) {
+        cerr << err.what() << endl;
+        cerr << "Usage: benchmark [--mesh 30,60] [--strategy cholesky,gaussian] [--precision float,double,long_double] "
+             << "[--stencil 5|9] [--output text|npy] [--warmup 2] [--repeat 10] [--threads N] [--json file]" << endl;
+        return 1;
+    }
+    catch(const runtime_error& err) { cerr << err.what() << endl; return 1; }
+    catch(const domain_error& err) { cerr << err.what() << endl; return 1; }
+    catch(const out_of_range& err) { cerr << err.what() << endl; return 1; }
+
+    return 0;
+}
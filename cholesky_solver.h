@@ -9,6 +9,10 @@
 #include "solver_strategy.h"
 #include "l_triangle_matrix.h"
 #include "u_triangle_matrix.h"
+#include "task_graph.h"
+
+/*! Edge length of the square tiles the Cholesky decomposition works on */
+const int CHOLESKY_TILE_SIZE = 64;
 
 /*! Chomsky solver class */
 template <class T>
@@ -16,6 +20,26 @@ class Cholesky_Solver : public virtual Solver_Strategy<T> {
     private:
         int m_size;
 
+        // Factors produced by `factorize`, kept for repeated substitutions
+        L_Triangle_Matrix<T> m_l_matrix;
+        U_Triangle_Matrix<T> m_u_matrix;
+
+        ////////////////////////////////// Tile kernels (row-major nb x nb tiles) //////////////////////////////////
+        /*! POTRF: factors the diagonal tile in place into its lower Cholesky factor
+          *
+          * \throws domain_error thrown if the tile is not positive definite
+        */
+        static void factor_tile(T* diagonal, const int nb);
+
+        /*! TRSM: overwrites `tile` with tile * L^-T, where L is the factored diagonal tile of its column */
+        static void solve_tile(const T* diagonal, T* tile, const int nb);
+
+        /*! SYRK: subtracts tile * tile^T from the lower half of the diagonal tile `target` */
+        static void update_diagonal_tile(const T* tile, T* target, const int nb);
+
+        /*! GEMM: subtracts left * right^T from `target` */
+        static void update_tile(const T* left, const T* right, T* target, const int nb);
+
     public:
         /*! Function operator overload implementing Cholesky decomposition followed by substitution
           *
@@ -31,7 +55,68 @@ class Cholesky_Solver : public virtual Solver_Strategy<T> {
           * \throws domain_error thrown if preconditions 2 or 4 are broken
         */
         Vector<T> solve(const Base_Matrix<T>& matrix, Vector<T> vec);
+
+        /*! Performs the Cholesky decomposition of `matrix` and stores L and L* for later substitutions
+          *
+          * The lower triangle is split into CHOLESKY_TILE_SIZE tiles and factored as a graph of
+          * tile tasks (POTRF, TRSM, SYRK, GEMM) that runs out of order on the default scheduler,
+          * critical path first.
+          *
+          * \param matrix the matrix to perform Cholesky decomposition
+          * 
+          * \pre T(0) is defined
+          * \pre dividend values in the algorithm should be non-zero; values in square root should be >= 0
+          * \post the factors of `matrix` are stored
+          * \throws domain_error thrown if pre-condition 2 is broken
+        */
+        void factorize(const Base_Matrix<T>& matrix);
+
+        /*! Solves L * L* * x = vec using the stored factors (forward and back substitution only)
+          *
+          * \param vec the right hand side
+          * \return a vector x representing the solution of matrix * x = vec
+          * 
+          * \pre `factorize` has been called
+          * \pre vec.get_size() matches the size of the factored matrix
+          * \post (see return)
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        Vector<T> substitute(Vector<T> vec) const;
+
+        /*! Solves L * L* * x = b for SIMD_LANES interleaved right hand sides in place, every
+          * substitution step running across all lanes (see Solver_Strategy)
+          *
+          * \pre `factorize` has been called
+          * \pre size matches the size of the factored matrix
+          * \post `block` holds the interleaved solutions
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        void substitute_interleaved(T* block, const int& size) const;
+
+        /*! Gets the number of values in the packed lower triangle of L (size * (size + 1) / 2) */
+        size_t get_factor_count() const;
+
+        /*! Gets the estimated floating point operations of `factorize` (n^3 / 3) */
+        double get_factor_flops() const { return double(m_size) * double(m_size) * double(m_size) / 3; }
+
+        /*! Gets the estimated floating point operations of one `substitute` (2 n^2) */
+        double get_substitute_flops() const { return 2.0 * double(m_size) * double(m_size); }
+
+        /*! Copies the rows of L (columns 0 to row) into `factor`
+          *
+          * \pre `factorize` has been called and `factor` holds get_factor_count() elements
+          * \post `factor` holds L
+        */
+        void export_factor(T* factor) const;
+
+        /*! Restores L (and L*) from values written by `export_factor`
+          *
+          * \pre `factor` was exported from a factorization of `matrix`
+          * \post the factors of `matrix` are stored
+          * \throws domain_error thrown if `count` does not fit `matrix`
+        */
+        void import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count);
 };
 
 #include "cholesky_solver.hpp"
-#endif
\ No newline at end of file
+#endif
@@ -6,48 +6,254 @@
 
 template <typename T>
 Vector<T> Cholesky_Solver<T>::solve(const Base_Matrix<T>& matrix, Vector<T> vec) {
-    m_size = matrix.get_size();
+    if (matrix.get_size() != vec.get_size()) { throw domain_error("Error: Matrix and vector to be solved must be of same size."); }
 
-    // Storage for final lower triangular matrix produced from Cholesky decomposition
-    L_Triangle_Matrix<T> l_matrix(matrix);
+    factorize(matrix);
 
-    // Used to not alter original matrix
-    Vector<Vector<T>> matrix_data = matrix.get_elements();
+    return substitute(vec);
+}
 
-    // Checking for division by zero
-    T dividend;
+template <typename T>
+void Cholesky_Solver<T>::factor_tile(T* diagonal, const int nb) {
+    for (int row = 0; row < nb; row++) {
+        T* row_ptr = diagonal + row * nb;
 
-    // Decompose
-    for (int row = 0; row < m_size; row++) {
         // Compute values under the diagonal for the given row
         for (int col = 0; col < row; col++) {
+            const T* col_ptr = diagonal + col * nb;
             T sum(0);
-            for (int runner = 0; runner < col; runner++) { 
-                sum += l_matrix.get_element(row, runner) * l_matrix.get_element(col, runner);
+            for (int runner = 0; runner < col; runner++) {
+                sum += row_ptr[runner] * col_ptr[runner];
             }
 
-            dividend = l_matrix.get_element(col, col);
-            if (dividend == 0) { throw domain_error("Error: Division by zero while solving symmetric matrix."); }
-
-            T val = (1 / dividend) * (matrix_data[row][col] - sum);
-            l_matrix.set_element(row, col, val);
+            if (col_ptr[col] == 0) { throw domain_error("Error: Division by zero while solving symmetric matrix."); }
+            row_ptr[col] = (row_ptr[col] - sum) / col_ptr[col];
         }
 
         // Compute value on the diagonal of this row
         T sum_squared_row(0);
         for (int col = 0; col < row; col++) {
-            sum_squared_row += pow(l_matrix.get_element(row, col), 2);
+            sum_squared_row += row_ptr[col] * row_ptr[col];
         }
 
-        dividend = matrix_data[row][row] - sum_squared_row;
+        T dividend = row_ptr[row] - sum_squared_row;
         if (dividend < 0) { throw domain_error("Error: Imaginary numbers are about to run amok while solving a symmetric matrix."); }
 
-        l_matrix.set_element(row, row, sqrt(dividend));
+        row_ptr[row] = sqrt(dividend);
+    }
+
+    return;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::solve_tile(const T* diagonal, T* tile, const int nb) {
+    for (int row = 0; row < nb; row++) {
+        T* row_ptr = tile + row * nb;
+
+        for (int col = 0; col < nb; col++) {
+            const T* l_row = diagonal + col * nb;
+            T sum(0);
+            for (int runner = 0; runner < col; runner++) {
+                sum += row_ptr[runner] * l_row[runner];
+            }
+
+            if (l_row[col] == 0) { throw domain_error("Error: Division by zero while solving symmetric matrix."); }
+            row_ptr[col] = (row_ptr[col] - sum) / l_row[col];
+        }
+    }
+
+    return;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::update_diagonal_tile(const T* tile, T* target, const int nb) {
+    for (int row = 0; row < nb; row++) {
+        const T* left = tile + row * nb;
+
+        for (int col = 0; col <= row; col++) {
+            const T* right = tile + col * nb;
+            T sum(0);
+            for (int runner = 0; runner < nb; runner++) {
+                sum += left[runner] * right[runner];
+            }
+            target[row * nb + col] -= sum;
+        }
+    }
+
+    return;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::update_tile(const T* left, const T* right, T* target, const int nb) {
+    for (int row = 0; row < nb; row++) {
+        const T* left_row = left + row * nb;
+
+        for (int col = 0; col < nb; col++) {
+            const T* right_row = right + col * nb;
+            T sum(0);
+            for (int runner = 0; runner < nb; runner++) {
+                sum += left_row[runner] * right_row[runner];
+            }
+            target[row * nb + col] -= sum;
+        }
+    }
+
+    return;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::factorize(const Base_Matrix<T>& matrix) {
+    m_size = matrix.get_size();
+
+    // Tile layout: the matrix is padded to a whole number of tiles with an identity block
+    const int nb = min(CHOLESKY_TILE_SIZE, max(m_size, 1));
+    const int num_tiles = (m_size + nb - 1) / nb;
+    const int padded_size = num_tiles * nb;
+    Vector<Vector<T> > tiles(num_tiles * (num_tiles + 1) / 2);
+    for (int i = 0; i < tiles.get_max(); i++) {
+        tiles.push_back(Vector<T>(nb * nb, 0));
+    }
+
+    // Lower tile (i, j), i >= j
+    struct Tile_Index {
+        static int of(const int i, const int j) { return i * (i + 1) / 2 + j; }
+    };
+
+    if (this->m_control != nullptr) { this->m_control->check(); }
+
+    // Copy the lower triangle into the tiles
+    default_scheduler().parallel_for(0, padded_size, [&](int row) {
+        int tile_row = row / nb;
+        for (int col = 0; col <= row; col++) {
+            T val = (row < m_size) ? matrix.get_row_element(row)[col] : T(row == col ? 1 : 0);
+            tiles[Tile_Index::of(tile_row, col / nb)][(row % nb) * nb + (col % nb)] = val;
+        }
+    });
+
+    // Build the tile task graph; each task depends on the last task that wrote the tiles it uses
+    Task_Graph graph;
+    Vector<int> last_writer(tiles.get_size(), -1);
+    const double tile_flops = double(nb) * nb * nb;
+
+    // Makes `task` wait for the last writer of tile (i, j) and, if it writes the tile, become its last writer
+    auto uses = [&](const int task, const int i, const int j, const bool writes) {
+        int& writer = last_writer[Tile_Index::of(i, j)];
+        if (writer >= 0) { graph.add_dependency(writer, task); }
+        if (writes) { writer = task; }
+    };
+
+    // Every tile task is a cancellation point and reports the share of the factorization's flops it finished
+    Solve_Control* control = this->m_control;
+    const double total_flops = double(num_tiles) * num_tiles * num_tiles * tile_flops / 3;
+    std::atomic<long long> finished_flops(0);
+    auto add_task = [&](const std::function<void()>& work, const double cost) {
+        if (control == nullptr) { return graph.add_task(work, cost); }
+        return graph.add_task([work, cost, control, total_flops, &finished_flops]() {
+            control->check();
+            work();
+            long long done = finished_flops.fetch_add((long long)cost) + (long long)cost;
+            control->set_progress(min(1.0, done / total_flops));
+        }, cost);
+    };
+
+    for (int k = 0; k < num_tiles; k++) {
+        T* diagonal = tiles[Tile_Index::of(k, k)].get_ptr();
+        int potrf = add_task([diagonal, nb]() { factor_tile(diagonal, nb); }, tile_flops / 3);
+        uses(potrf, k, k, true);
+
+        for (int i = k + 1; i < num_tiles; i++) {
+            T* tile = tiles[Tile_Index::of(i, k)].get_ptr();
+            int trsm = add_task([diagonal, tile, nb]() { solve_tile(diagonal, tile, nb); }, tile_flops);
+            uses(trsm, k, k, false);
+            uses(trsm, i, k, true);
+        }
+
+        for (int i = k + 1; i < num_tiles; i++) {
+            const T* tile_ik = tiles[Tile_Index::of(i, k)].get_ptr();
+            T* target = tiles[Tile_Index::of(i, i)].get_ptr();
+            int syrk = add_task([tile_ik, target, nb]() { update_diagonal_tile(tile_ik, target, nb); }, tile_flops);
+            uses(syrk, i, k, false);
+            uses(syrk, i, i, true);
+
+            for (int j = k + 1; j < i; j++) {
+                const T* tile_jk = tiles[Tile_Index::of(j, k)].get_ptr();
+                T* off_target = tiles[Tile_Index::of(i, j)].get_ptr();
+                int gemm = add_task([tile_ik, tile_jk, off_target, nb]() { update_tile(tile_ik, tile_jk, off_target, nb); }, 2 * tile_flops);
+                uses(gemm, i, k, false);
+                uses(gemm, j, k, false);
+                uses(gemm, i, j, true);
+            }
+        }
+    }
+
+    graph.run(default_scheduler());
+
+    // Storage for final lower triangular matrix produced from Cholesky decomposition
+    L_Triangle_Matrix<T> l_matrix(matrix);
+    default_scheduler().parallel_for(0, m_size, [&](int row) {
+        T* l_row = l_matrix.get_row_ref(row).get_ptr();
+        for (int col = 0; col <= row; col++) {
+            l_row[col] = tiles[Tile_Index::of(row / nb, col / nb)][(row % nb) * nb + (col % nb)];
+        }
+    });
+
+    // Keep L and L* for the substitutions
+    m_u_matrix = U_Triangle_Matrix<T>(l_matrix.transpose());
+    m_l_matrix = l_matrix;
+
+    return;
+}
+
+template <typename T>
+Vector<T> Cholesky_Solver<T>::substitute(Vector<T> vec) const {
+    if (m_l_matrix.get_size() != vec.get_size()) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    // Perform back substitutions for L and L* in place on the stored factors
+    m_l_matrix.template back_sub_interleaved<1>(vec.get_ptr());
+    m_u_matrix.template back_sub_interleaved<1>(vec.get_ptr());
+
+    return vec;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::substitute_interleaved(T* block, const int& size) const {
+    if (m_l_matrix.get_size() != size) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    m_l_matrix.template back_sub_interleaved<SIMD_LANES>(block);
+    m_u_matrix.template back_sub_interleaved<SIMD_LANES>(block);
+
+    return;
+}
+
+template <typename T>
+size_t Cholesky_Solver<T>::get_factor_count() const {
+    return size_t(m_l_matrix.get_size()) * size_t(m_l_matrix.get_size() + 1) / 2;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::export_factor(T* factor) const {
+    for (int row = 0; row < m_l_matrix.get_size(); row++) {
+        const T* l_row = m_l_matrix.get_row_element(row).get_ptr();
+        copy(l_row, l_row + row + 1, factor + size_t(row) * size_t(row + 1) / 2);
     }
 
-    // Perform back substitutions for L and L*
-    U_Triangle_Matrix<T> u_matrix(l_matrix.transpose());
-    Vector<T> temp = l_matrix.back_sub(l_matrix.get_elements(), vec);
+    return;
+}
+
+template <typename T>
+void Cholesky_Solver<T>::import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count) {
+    int size = matrix.get_size();
+    if (count != size_t(size) * size_t(size + 1) / 2) { throw domain_error("Error: Stored factor does not match the size of the matrix."); }
+
+    L_Triangle_Matrix<T> l_matrix(matrix);
+    default_scheduler().parallel_for(0, size, [&](int row) {
+        const T* packed_row = factor + size_t(row) * size_t(row + 1) / 2;
+        copy(packed_row, packed_row + row + 1, l_matrix.get_row_ref(row).get_ptr());
+    });
+
+    m_size = size;
+    m_u_matrix = U_Triangle_Matrix<T>(l_matrix.transpose());
+    m_l_matrix = l_matrix;
 
-    return u_matrix.back_sub(u_matrix.get_elements(), temp);
-}
\ No newline at end of file
+    return;
+}
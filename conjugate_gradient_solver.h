@@ -0,0 +1,113 @@
+/*! \file
+ *  Conjugate_Gradient_Solver class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef CONJUGATE_GRADIENT_SOLVER_H
+#define CONJUGATE_GRADIENT_SOLVER_H
+#include "solver_strategy.h"
+#include "linear_operator.h"
+#include <mutex>
+
+/*! Conjugate gradient solver class (iterative strategy for symmetric positive definite systems) */
+template <class T>
+class Conjugate_Gradient_Solver : public virtual Solver_Strategy<T> { 
+    private:
+        T m_tolerance;
+        int m_max_iterations;
+
+        // Operator being solved; owned when it wraps a matrix
+        const Linear_Operator<T>* m_operator;
+        Matrix_Operator<T>* m_matrix_operator;
+
+        // Statistics of the most recent substitution (substitutions may run concurrently)
+        mutable std::mutex m_stats_mutex;
+        mutable int m_iterations;
+        mutable T m_residual;
+
+    public:
+        /*! Constructs a conjugate gradient solver
+          *
+          * \param tolerance the relative residual (|r| / |b|) to stop iterating at
+          * \param max_iterations the maximum number of iterations before giving up
+          * 
+          * \pre tolerance > 0
+          * \pre max_iterations > 0
+          * \post the tolerance is raised to a few machine epsilons of T if it is tighter than T can resolve
+        */
+        Conjugate_Gradient_Solver(const double& tolerance = ITERATIVE_TOLERANCE, const int& max_iterations = MAX_ITERATIONS);
+
+        /*! Destructor */
+        ~Conjugate_Gradient_Solver() { delete m_matrix_operator; }
+
+        /*! Solves matrix * x = vec with the conjugate gradient method
+          *
+          * \param matrix the symmetric positive definite matrix
+          * \param vec the right hand side
+          * \return a vector x representing the solution of matrix * x = vec
+          * 
+          * \pre `matrix` is symmetric positive definite
+          * \pre matrix.get_size() == vec.get_size()
+          * \post (see return)
+          * \throws domain_error thrown if the sizes differ
+          * \throws runtime_error thrown if the method does not converge
+        */
+        Vector<T> solve(const Base_Matrix<T>& matrix, Vector<T> vec);
+
+        /*! Solves op * x = vec with the conjugate gradient method (matrix-free)
+          *
+          * \param op the symmetric positive definite operator
+          * \param vec the right hand side
+          * \return a vector x representing the solution of op * x = vec
+          * 
+          * \pre `op` is symmetric positive definite
+          * \pre op.get_size() == vec.get_size()
+          * \post (see return)
+          * \throws domain_error thrown if the sizes differ
+          * \throws runtime_error thrown if the method does not converge
+        */
+        Vector<T> solve(const Linear_Operator<T>& op, Vector<T> vec);
+
+        /*! Nothing to factor; stores the matrix so that `substitute` can iterate on it
+          *
+          * \pre `matrix` outlives this solver
+          * \post the matrix is wrapped as the operator to solve
+        */
+        void factorize(const Base_Matrix<T>& matrix);
+
+        /*! Stores the operator so that `substitute` can iterate on it
+          *
+          * \pre `op` outlives this solver
+          * \post `op` is the operator to solve
+        */
+        void factorize(const Linear_Operator<T>& op);
+
+        /*! Runs the conjugate gradient iteration on the stored operator
+          *
+          * \param vec the right hand side
+          * \return a vector x representing the solution of op * x = vec
+          * 
+          * \pre `factorize` has been called
+          * \pre vec.get_size() matches the size of the operator
+          * \post the iteration count and final relative residual are updated
+          * \throws domain_error thrown if pre-conditions are broken
+          * \throws runtime_error thrown if the method does not converge
+        */
+        Vector<T> substitute(Vector<T> vec) const;
+
+        /*! Getter for the number of iterations taken by the last solve */
+        int get_iterations() const { std::lock_guard<std::mutex> lock(m_stats_mutex); return m_iterations; }
+
+        /*! Gets the estimated floating point operations of the last `substitute` (one product and 10 n per iteration) */
+        double get_substitute_flops() const {
+            if (m_operator == nullptr) { return 0; }
+            return get_iterations() * (m_operator->get_apply_flops() + 10.0 * double(m_operator->get_size()));
+        }
+
+        /*! Getter for the relative residual reached by the last solve */
+        T get_residual() const { std::lock_guard<std::mutex> lock(m_stats_mutex); return m_residual; }
+};
+
+#include "conjugate_gradient_solver.hpp"
+#endif
@@ -0,0 +1,91 @@
+/*! \file
+ *  Function definitions for the `Conjugate_Gradient_Solver` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Conjugate_Gradient_Solver<T>::Conjugate_Gradient_Solver(const double& tolerance, const int& max_iterations)
+    : m_tolerance(max(T(tolerance), T(10) * numeric_limits<T>::epsilon())), m_max_iterations(max_iterations),
+      m_operator(nullptr), m_matrix_operator(nullptr), m_iterations(0), m_residual(0) {
+    if (tolerance <= 0) { throw domain_error("Error: Iterative tolerance should be greater than 0."); }
+    if (max_iterations <= 0) { throw domain_error("Error: Maximum number of iterations should be greater than 0."); }
+}
+
+template <typename T>
+Vector<T> Conjugate_Gradient_Solver<T>::solve(const Base_Matrix<T>& matrix, Vector<T> vec) {
+    factorize(matrix);
+
+    return substitute(vec);
+}
+
+template <typename T>
+Vector<T> Conjugate_Gradient_Solver<T>::solve(const Linear_Operator<T>& op, Vector<T> vec) {
+    factorize(op);
+
+    return substitute(vec);
+}
+
+template <typename T>
+void Conjugate_Gradient_Solver<T>::factorize(const Base_Matrix<T>& matrix) {
+    delete m_matrix_operator;
+    m_matrix_operator = new Matrix_Operator<T>(matrix);
+    m_operator = m_matrix_operator;
+
+    return;
+}
+
+template <typename T>
+void Conjugate_Gradient_Solver<T>::factorize(const Linear_Operator<T>& op) {
+    delete m_matrix_operator;
+    m_matrix_operator = nullptr;
+    m_operator = &op;
+
+    return;
+}
+
+template <typename T>
+Vector<T> Conjugate_Gradient_Solver<T>::substitute(Vector<T> vec) const {
+    if (m_operator == nullptr || m_operator->get_size() != vec.get_size()) { throw domain_error("Error: Conjugate gradient requires an operator of same size as the vector."); }
+
+    // Start from x = 0 so the residual is the right hand side
+    Vector<T> result(vec.get_size(), 0);
+    Vector<T> residual(vec);
+    Vector<T> direction(vec);
+    T rhs_norm = sqrt(vec * vec);
+    T residual_squared = residual * residual;
+
+    int iterations = 0;
+    while (rhs_norm != 0 && sqrt(residual_squared) > m_tolerance * rhs_norm) {
+        if (iterations == m_max_iterations) { throw runtime_error("Error: Conjugate gradient did not converge within the maximum number of iterations."); }
+
+        // Progress is the share of the residual reduction (in orders of magnitude) reached so far
+        if (this->m_control != nullptr) {
+            this->m_control->check();
+            double relative = double(sqrt(residual_squared) / rhs_norm);
+            this->m_control->set_residual(relative);
+            this->m_control->set_progress(max(0.0, min(1.0, log(relative) / log(double(m_tolerance)))));
+        }
+
+        Vector<T> image = (*m_operator) * direction;
+        T curvature = direction * image;
+        if (curvature <= 0) { throw domain_error("Error: Conjugate gradient requires a positive definite operator."); }
+
+        T alpha = residual_squared / curvature;
+        result.axpy(alpha, direction);
+        residual.axpy(-alpha, image);
+
+        T next_residual_squared = residual * residual;
+        direction.axpby(T(1), residual, next_residual_squared / residual_squared);
+        residual_squared = next_residual_squared;
+        iterations++;
+    }
+
+    if (this->m_control != nullptr) { this->m_control->set_residual((rhs_norm == 0) ? 0.0 : double(sqrt(residual_squared) / rhs_norm)); }
+
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    m_iterations = iterations;
+    m_residual = (rhs_norm == 0) ? T(0) : sqrt(residual_squared) / rhs_norm;
+
+    return result;
+}
@@ -42,6 +42,37 @@ long double exact_eqn(long double x, long double y) {
     return (1/sinh(M_PI)) * ((sin(x) * sinh(M_PI-y)) + (sin(y) * sinh(M_PI-x)));
 }
 
+/* Solves the mesh in precision T, reports the error and writes the solution to file */
+template <typename T>
+void solve_mesh(const double lower_bound, const double upper_bound, const int mesh_length, const bool gauss_override, const bool use_nine_point, const bool binary_output) {
+    Stencil stencil = use_nine_point ? nine_point : five_point;
+
+    // Solving method
+    high_resolution_clock::time_point t1 = high_resolution_clock::now();
+    Matrix_Solver<T> solver(lower_bound, upper_bound, mesh_length, gauss_override, upper, lower, right, left, stencil);
+    Vector<T> result;
+
+    // Solver test
+    result = solver.solve();
+    high_resolution_clock::time_point t2 = high_resolution_clock::now();
+    double elapsed = duration_cast<microseconds>(t2-t1).count() / 1000000.0;
+    cout << "Elapsed time: " << elapsed <<endl;
+
+    // Find exact solution
+    Vector<T> exact_solution;
+    exact_solution = gen_exact_sol<T>(lower_bound, upper_bound, mesh_length, &exact_eqn);
+
+    // Find norm
+    T norm = error_norm(lower_bound, upper_bound, mesh_length, result, exact_solution);
+    cout << "Norm: " << norm <<endl;
+
+    // Output data to file
+    cout << "Outputting solution to file..." << endl;
+    string file_name = (gauss_override ? "gauss_points_" : "cholesky_points_") + string(use_nine_point ? "9pt_" : "") + to_string(mesh_length);
+    if (binary_output) { write_npy(lower_bound, upper_bound, mesh_length, result, file_name + ".npy"); }
+    else { output_to_file(lower_bound, upper_bound, mesh_length, result, file_name + ".txt"); }
+}
+
 int main() {
 
     try {
@@ -49,6 +80,9 @@ int main() {
         double upper_bound = M_PI;
         int mesh_length;
         bool gauss_override;
+        bool use_nine_point;
+        int precision;
+        bool binary_output;
 
         // Input mesh length
         cout << "Mesh length: "; 
@@ -58,33 +92,35 @@ int main() {
         cout << "Solver Technique (1 for Gaussian, 0 for Cholesky): ";
         cin >> gauss_override;
 
-        // Solving method
-        high_resolution_clock::time_point t1 = high_resolution_clock::now();
-        Matrix_Solver<long double> solver(lower_bound, upper_bound, mesh_length, gauss_override, upper, lower, right, left);
-        Vector<long double> result;
-
-        // Solver test
-        result = solver.solve();
-        high_resolution_clock::time_point t2 = high_resolution_clock::now();
-        double elapsed = duration_cast<microseconds>(t2-t1).count() / 1000000.0;
-        cout << "Elapsed time: " << elapsed <<endl;
-
-        // Find exact solution
-        Vector<long double> exact_solution;
-        exact_solution = gen_exact_sol<long double>(lower_bound, upper_bound, mesh_length, &exact_eqn);
-
-        // Find norm
-        long double norm;
-        long double sum = 0;
-        int size = result.get_size();
-        for (int i=0; i<size; i++)
-            sum += (result[i] - exact_solution[i]) * (result[i] - exact_solution[i]);
-        norm = sqrt(((upper_bound/mesh_length)*(upper_bound/mesh_length)) * sum);
-        cout << "Norm: " << norm <<endl;
-
-        // Output data to file
-        cout << "Outputting solution to file..." << endl;
-        output_to_file(lower_bound, upper_bound, mesh_length, result, gauss_override ? "gauss_points_" + to_string(mesh_length) + ".txt" : "cholesky_points_" + to_string(mesh_length) + ".txt");
+        // Stencil option
+        cout << "Stencil (1 for 9-point fourth order, 0 for 5-point): ";
+        cin >> use_nine_point;
+
+        // Precision option
+        cout << "Precision (0 for float, 1 for double, 2 for long double, 3 to compare all): ";
+        cin >> precision;
+
+        // Output format option
+        cout << "Output format (1 for binary .npy, 0 for text): ";
+        cin >> binary_output;
+        if (cin.fail()) { throw domain_error("Error: Expected a number for every input."); }
+
+        switch (precision) {
+            case float_precision: solve_mesh<float>(lower_bound, upper_bound, mesh_length, gauss_override, use_nine_point, binary_output); break;
+            case double_precision: solve_mesh<double>(lower_bound, upper_bound, mesh_length, gauss_override, use_nine_point, binary_output); break;
+            case long_double_precision: solve_mesh<long double>(lower_bound, upper_bound, mesh_length, gauss_override, use_nine_point, binary_output); break;
+            case 3: {
+                // Time and error of every precision (solved one at a time so the timings are comparable)
+                Sweep_Engine sweep(lower_bound, upper_bound, upper, lower, right, left, &exact_eqn);
+                for (int p = float_precision; p <= long_double_precision; p++) {
+                    sweep.add_job(mesh_length, gauss_override ? gaussian_strategy : cholesky_strategy, Precision(p), use_nine_point ? nine_point : five_point);
+                }
+                sweep.run(0, 1);
+                sweep.write_precision_report(cout);
+                break;
+            }
+            default: throw domain_error("Error: Precision should be 0, 1, 2 or 3.");
+        }
     }
     catch(const invalid_argument& err) { cerr << err.what() << endl; }
     catch(const runtime_error& err) { cerr << err.what() << endl; }
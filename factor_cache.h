@@ -0,0 +1,137 @@
+/*! \file
+ *  Factor_Cache class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef FACTOR_CACHE_H
+#define FACTOR_CACHE_H
+#include "libraries.h"
+#include "solve_control.h"
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/*! Environment variable holding the capacity of the process-wide factor cache in MiB (0 disables it) */
+const char* const FACTOR_CACHE_VARIABLE = "FDS_FACTOR_CACHE_MB";
+
+/*! Capacity of the process-wide factor cache in MiB when FDS_FACTOR_CACHE_MB is unset */
+const int FACTOR_CACHE_DEFAULT_MB = 256;
+
+/*! Identifies a factorization that can be shared between solvers
+ *
+ *  The fields hold the values of the corresponding enums (Stencil, Factor_Kind) and
+ *  numeric_limits<T>::digits for the precision, so the cache does not depend on the solver headers.
+ */
+struct Factor_Key {
+    int operator_kind;  // stencil of the coefficient matrix
+    int mesh_length;
+    int precision;      // numeric_limits<T>::digits
+    int strategy;       // Factor_Kind
+
+    /*! Orders keys field by field */
+    bool operator<(const Factor_Key& other) const;
+};
+
+/*! Counters of a `Factor_Cache` */
+struct Factor_Cache_Stats {
+    long long hits;        // lookups served by a stored or in-flight factorization
+    long long misses;      // lookups that had to factor
+    long long evictions;   // factorizations dropped to stay within the capacity
+    int entries;           // factorizations stored (including in-flight ones)
+    size_t bytes;          // approximate memory held by the stored factorizations
+    size_t capacity;       // byte capacity
+};
+
+/*! Thread-safe LRU cache of factorizations shared by solvers of the same mesh
+ *
+ *  Values are held through shared_ptr, so a factorization evicted from the cache stays alive for
+ *  the solvers still using it. A lookup that misses inserts an in-flight entry before it starts
+ *  factoring; concurrent lookups of the same key wait on that entry's shared_future instead of
+ *  factoring again. If the factorization fails the entry is removed and the waiters see the
+ *  exception, except a cancellation (Solve_Cancelled), after which a waiter retries and factors
+ *  itself: it did not ask for the cancellation.
+ *
+ *  Least recently used entries are evicted once the stored bytes exceed the capacity. A capacity of
+ *  0 disables the cache (every lookup factors and nothing is stored).
+ */
+class Factor_Cache {
+    private:
+        /*! A stored or in-flight factorization */
+        struct Entry {
+            std::shared_future<std::shared_ptr<void> > value;
+            size_t bytes;
+            bool ready;
+            long long generation;
+            std::list<Factor_Key>::iterator position;
+        };
+
+        std::mutex m_mutex;
+        std::map<Factor_Key, Entry> m_entries;
+
+        // Most recently used first
+        std::list<Factor_Key> m_order;
+
+        size_t m_capacity;
+        size_t m_bytes;
+        long long m_hits;
+        long long m_misses;
+        long long m_evictions;
+        long long m_generation;
+
+        /*! Drops least recently used ready entries until the stored bytes fit the capacity
+          *
+          * \pre m_mutex is held
+        */
+        void evict();
+
+        /*! Type-erased lookup behind `get` */
+        std::shared_ptr<void> get_erased(const Factor_Key& key, const std::function<std::shared_ptr<void>(size_t&)>& build);
+
+        // The process-wide cache is not copied
+        Factor_Cache(const Factor_Cache&);
+        Factor_Cache& operator=(const Factor_Cache&);
+
+    public:
+        /*! Constructs an empty cache
+          *
+          * \param capacity the byte capacity (0 disables the cache)
+          * \post the cache is empty and its counters are 0
+        */
+        explicit Factor_Cache(const size_t& capacity);
+
+        /*! Gets the factorization stored under `key`, calling `build` to create it on a miss
+          *
+          * \param key the factorization to look up
+          * \param build called as build(bytes) on a miss; returns the factorization and sets bytes to
+          *        its approximate size
+          * \return the factorization
+          *
+          * \pre every value stored under `key` has type Value
+          * \post the factorization is the most recently used entry (if the cache is enabled)
+          * \throws rethrows the exception thrown by `build`, here or in a concurrent lookup of the same key
+        */
+        template <typename Value>
+        std::shared_ptr<Value> get(const Factor_Key& key, const std::function<std::shared_ptr<Value>(size_t&)>& build);
+
+        /*! Gets the counters */
+        Factor_Cache_Stats get_stats();
+
+        /*! Sets the byte capacity, evicting entries that no longer fit (0 disables the cache) */
+        void set_capacity(const size_t& capacity);
+
+        /*! Drops every stored factorization (in-flight ones are kept for their waiters) and zeroes the counters */
+        void clear();
+};
+
+/*! Gets the factor cache shared by the library. Its capacity is taken from the FDS_FACTOR_CACHE_MB
+ *  environment variable, or FACTOR_CACHE_DEFAULT_MB if unset.
+ * \relatesalso Factor_Cache
+ */
+Factor_Cache& factor_cache();
+
+#include "factor_cache.hpp"
+#endif
@@ -0,0 +1,150 @@
+/*! \file
+ *  Function definitions for the `Factor_Cache` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline bool Factor_Key::operator<(const Factor_Key& other) const {
+    if (operator_kind != other.operator_kind) return operator_kind < other.operator_kind;
+    if (mesh_length != other.mesh_length) return mesh_length < other.mesh_length;
+    if (precision != other.precision) return precision < other.precision;
+    return strategy < other.strategy;
+}
+
+inline Factor_Cache::Factor_Cache(const size_t& capacity)
+    : m_capacity(capacity), m_bytes(0), m_hits(0), m_misses(0), m_evictions(0), m_generation(0) {}
+
+inline void Factor_Cache::evict() {
+    std::list<Factor_Key>::iterator candidate = m_order.end();
+    while (m_bytes > m_capacity && candidate != m_order.begin()) {
+        --candidate;
+        std::map<Factor_Key, Entry>::iterator entry = m_entries.find(*candidate);
+
+        // In-flight entries hold no bytes yet and have waiters; they are left alone
+        if (!entry->second.ready) { continue; }
+
+        m_bytes -= entry->second.bytes;
+        m_evictions++;
+        m_entries.erase(entry);
+        candidate = m_order.erase(candidate);
+    }
+
+    return;
+}
+
+inline std::shared_ptr<void> Factor_Cache::get_erased(const Factor_Key& key, const std::function<std::shared_ptr<void>(size_t&)>& build) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true) {
+        std::map<Factor_Key, Entry>::iterator found = m_entries.find(key);
+        if (found != m_entries.end()) {
+            m_hits++;
+            m_order.splice(m_order.begin(), m_order, found->second.position);
+            std::shared_future<std::shared_ptr<void> > value = found->second.value;
+
+            lock.unlock();
+            try {
+                return value.get();
+            }
+            catch (const Solve_Cancelled&) {
+                // Another solve cancelled its factorization (and removed the entry); factor it here instead
+                lock.lock();
+                continue;
+            }
+        }
+
+        m_misses++;
+        size_t bytes = 0;
+        if (m_capacity == 0) {
+            lock.unlock();
+            return build(bytes);
+        }
+
+        // Publish the in-flight entry before factoring so concurrent lookups wait for it
+        std::promise<std::shared_ptr<void> > promise;
+        long long generation = ++m_generation;
+        m_order.push_front(key);
+        Entry entry = { promise.get_future().share(), 0, false, generation, m_order.begin() };
+        m_entries.insert(std::make_pair(key, entry));
+        lock.unlock();
+
+        std::shared_ptr<void> value;
+        try {
+            value = build(bytes);
+        }
+        catch (...) {
+            lock.lock();
+            std::map<Factor_Key, Entry>::iterator own = m_entries.find(key);
+            if (own != m_entries.end() && own->second.generation == generation) {
+                m_order.erase(own->second.position);
+                m_entries.erase(own);
+            }
+            lock.unlock();
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        lock.lock();
+        std::map<Factor_Key, Entry>::iterator own = m_entries.find(key);
+        if (own != m_entries.end() && own->second.generation == generation) {
+            own->second.ready = true;
+            own->second.bytes = bytes;
+            m_bytes += bytes;
+            evict();
+        }
+        lock.unlock();
+        promise.set_value(value);
+
+        return value;
+    }
+}
+
+template <typename Value>
+std::shared_ptr<Value> Factor_Cache::get(const Factor_Key& key, const std::function<std::shared_ptr<Value>(size_t&)>& build) {
+    return std::static_pointer_cast<Value>(get_erased(key, [&build](size_t& bytes) -> std::shared_ptr<void> { return build(bytes); }));
+}
+
+inline Factor_Cache_Stats Factor_Cache::get_stats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Factor_Cache_Stats stats = { m_hits, m_misses, m_evictions, int(m_entries.size()), m_bytes, m_capacity };
+
+    return stats;
+}
+
+inline void Factor_Cache::set_capacity(const size_t& capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+
+    return;
+}
+
+inline void Factor_Cache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Ready entries go; in-flight ones stay so their waiters are still served
+    for (std::list<Factor_Key>::iterator key = m_order.begin(); key != m_order.end();) {
+        std::map<Factor_Key, Entry>::iterator entry = m_entries.find(*key);
+        if (entry->second.ready) {
+            m_bytes -= entry->second.bytes;
+            m_entries.erase(entry);
+            key = m_order.erase(key);
+        }
+        else { ++key; }
+    }
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+
+    return;
+}
+
+inline Factor_Cache& factor_cache() {
+    static Factor_Cache cache([]() {
+        const char* value = getenv(FACTOR_CACHE_VARIABLE);
+        long megabytes = (value != nullptr) ? atol(value) : FACTOR_CACHE_DEFAULT_MB;
+        return size_t(max(megabytes, 0L)) << 20;
+    }());
+
+    return cache;
+}
@@ -0,0 +1,124 @@
+/*! \file
+ *  Factor checkpoint file format: Factor_Header, Factor_File and the checksum helpers.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef FACTOR_CHECKPOINT_H
+#define FACTOR_CHECKPOINT_H
+#include "libraries.h"
+#include "base_matrix.h"
+#include "mapped_file.h"
+#include <cstdint>
+#include <cstring>
+
+/*! Version written into new factor checkpoints; files of any other version are rejected */
+const uint32_t FACTOR_FILE_VERSION = 1;
+
+/*! FNV-1a 64 bit offset basis */
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+/*! FNV-1a 64 bit prime */
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+/*! Header at the start of a factor checkpoint (see Matrix_Solver::save_factor)
+ *
+ *  The file is this 64 byte header followed by `count` raw values of the solver's precision, in the
+ *  byte order of the machine that wrote it. The values start 64 bytes into the file, so they are
+ *  aligned for every precision when the file is mapped.
+ */
+struct Factor_Header {
+    char magic[8];              // "FDSFACT" followed by a NUL
+    uint32_t version;           // FACTOR_FILE_VERSION
+    uint32_t kind;              // strategy that produced the factor (Factor_Kind)
+    uint32_t scalar_size;       // sizeof(T)
+    uint32_t scalar_digits;     // numeric_limits<T>::digits (tells double from long double)
+    int32_t size;               // number of unknowns
+    int32_t mesh_length;        // mesh length of a generated 2D system, 0 otherwise
+    uint64_t count;             // number of values after the header
+    uint64_t matrix_checksum;   // checksum of the coefficient matrix (see matrix_checksum)
+    uint64_t checksum;          // checksum of the values (see checksum_values)
+    uint64_t reserved;          // 0
+};
+
+/*! Read-only memory mapping of a factor checkpoint
+ *
+ *  The constructor maps the file and checks everything that can be checked without a solver:
+ *  magic, version, and that the file holds exactly `count` values of `scalar_size` bytes.
+ */
+class Factor_File {
+    private:
+        Mapped_File m_file;
+
+    public:
+        /*! Maps `file_name`
+          *
+          * \param file_name the checkpoint to map
+          *
+          * \post the file is mapped read-only
+          * \throws runtime_error thrown if the file cannot be mapped or is not a factor checkpoint
+        */
+        explicit Factor_File(const string& file_name);
+
+        /*! Gets the header of the file */
+        const Factor_Header& get_header() const { return *reinterpret_cast<const Factor_Header*>(m_file.get_data()); }
+
+        /*! Gets the values following the header (get_header().count values of type T)
+          *
+          * \pre T matches the header's scalar size and digits
+        */
+        template <typename T>
+        const T* get_values() const { return reinterpret_cast<const T*>(m_file.get_data() + sizeof(Factor_Header)); }
+};
+
+/*! Fold `count` values into an FNV-1a hash, one 64 bit word at a time
+*
+*  Only the bytes that hold the value are hashed: x87 long doubles are 10 bytes of value padded to 16,
+*  and the padding is arbitrary. Those values are hashed as two words (8 bytes, then the remaining 2).
+*
+*  \param hash the hash so far (FNV_OFFSET_BASIS to start)
+*  \param values the values to hash
+*  \param count the number of values
+*  \return the updated hash
+*
+*  \pre none
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+template <typename T>
+uint64_t checksum_values(uint64_t hash, const T* values, const size_t& count);
+
+/*! Checksum of a coefficient matrix: its size and the stored elements of every row
+*
+*  Factor checkpoints record this so a factor is never loaded for a different matrix of the same size
+*  (for example the 9-point instead of the 5-point stencil).
+*
+*  \param matrix the matrix
+*  \return the checksum
+*
+*  \pre none
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+template <typename T>
+uint64_t matrix_checksum(const Base_Matrix<T>& matrix);
+
+/*! Write a factor checkpoint
+*
+*  The file is written under a temporary name and renamed into place, so a reader never maps a
+*  partially written checkpoint.
+*
+*  \param file_name the checkpoint to create (replaced if it exists)
+*  \param header the header (magic and version are filled in)
+*  \param values the header.count values to store
+*
+*  \pre header.count values are readable at `values`
+*  \post the checkpoint is written
+*  \throws runtime_error thrown if the file cannot be written
+*  \relates Matrix_Solver
+*/
+template <typename T>
+void write_factor_file(const string& file_name, Factor_Header header, const T* values);
+
+#include "factor_checkpoint.hpp"
+#endif
@@ -0,0 +1,64 @@
+/*! \file
+ *  Function definitions for the factor checkpoint file format.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline Factor_File::Factor_File(const string& file_name) : m_file(file_name, false) {
+    size_t bytes = m_file.get_size();
+    if (bytes < sizeof(Factor_Header)) { throw runtime_error("Error: " + file_name + " is not a factor checkpoint."); }
+
+    const Factor_Header& header = get_header();
+    if (memcmp(header.magic, "FDSFACT", 8) != 0 || header.version != FACTOR_FILE_VERSION
+        || header.scalar_size == 0 || header.count > (bytes - sizeof(Factor_Header)) / header.scalar_size
+        || sizeof(Factor_Header) + header.count * header.scalar_size != bytes) {
+        throw runtime_error("Error: " + file_name + " is not a version " + to_string(FACTOR_FILE_VERSION) + " factor checkpoint.");
+    }
+}
+
+template <typename T>
+uint64_t checksum_values(uint64_t hash, const T* values, const size_t& count) {
+    const size_t bytes = (numeric_limits<T>::digits == 64 && sizeof(T) > 10) ? 10 : sizeof(T);
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t words[2] = { 0, 0 };
+        memcpy(words, values + i, bytes);
+        hash = (hash ^ words[0]) * FNV_PRIME;
+        if (bytes > 8) { hash = (hash ^ words[1]) * FNV_PRIME; }
+    }
+
+    return hash;
+}
+
+template <typename T>
+uint64_t matrix_checksum(const Base_Matrix<T>& matrix) {
+    uint64_t hash = (FNV_OFFSET_BASIS ^ uint64_t(matrix.get_size())) * FNV_PRIME;
+
+    for (int row = 0; row < matrix.get_size(); row++) {
+        const Vector<T>& elements = matrix.get_row_element(row);
+        hash = (hash ^ uint64_t(elements.get_size())) * FNV_PRIME;
+        hash = checksum_values(hash, elements.get_ptr(), size_t(elements.get_size()));
+    }
+
+    return hash;
+}
+
+template <typename T>
+void write_factor_file(const string& file_name, Factor_Header header, const T* values) {
+    memcpy(header.magic, "FDSFACT", 8);
+    header.version = FACTOR_FILE_VERSION;
+
+    string temporary_name = file_name + ".tmp";
+    FILE* file = fopen(temporary_name.c_str(), "wb");
+    if (file == nullptr) { throw runtime_error("Error: Could not open " + temporary_name + " for writing."); }
+
+    size_t count = size_t(header.count);
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+                && fwrite(values, sizeof(T), count, file) == count;
+    if (fclose(file) != 0 || !written || rename(temporary_name.c_str(), file_name.c_str()) != 0) {
+        remove(temporary_name.c_str());
+        throw runtime_error("Error: Could not write factor checkpoint " + file_name + ".");
+    }
+
+    return;
+}
@@ -0,0 +1,167 @@
+/*! \file
+ *  Fixed_Mesh_Solver class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef FIXED_MESH_SOLVER_H
+#define FIXED_MESH_SOLVER_H
+#include "solver_strategy.h"
+
+/*! Largest mesh length `Matrix_Solver` hands to a `Fixed_Mesh_Solver` (225 unknowns) */
+const int FIXED_MESH_LIMIT = 16;
+
+/*! Banded Cholesky solver for the finite difference system of one fixed mesh length M
+ *
+ *  The (M - 1)^2 unknowns of a mesh couple only to points at most M positions away (M - 1 for the
+ *  5-point stencil, M for the corners of the 9-point stencil), so the Cholesky factor L fits in a
+ *  band of M + 1 entries per row. The band lives inside the object (no heap rows) and every loop has
+ *  a compile-time trip count. The band is padded with zero rows on both sides, so the substitution
+ *  loops run without bounds checks and the compiler can unroll them completely.
+ *
+ *  `solve(const T*, T*)` is the non-virtual entry point for code that does many tiny solves with the
+ *  same M. `Matrix_Solver` uses the class through the `Solver_Strategy` interface for meshes up to
+ *  FIXED_MESH_LIMIT (see make_fixed_mesh_solver).
+ */
+template <class T, int M>
+class Fixed_Mesh_Solver : public virtual Solver_Strategy<T> {
+    public:
+        /*! Number of unknowns, (M - 1)^2 */
+        static const int unknowns = (M - 1) * (M - 1);
+
+        /*! Half bandwidth of the system */
+        static const int band = M;
+
+    private:
+        // Row i of L holds L(i, i - k) at m_factor[band + i][k] (k = 0 to band); the first and last
+        // `band` rows are zero padding
+        T m_factor[unknowns + 2 * band][band + 1];
+
+        // 1 / L(i, i)
+        T m_inverse_diagonal[unknowns];
+
+        bool m_factored;
+
+    public:
+        /*! Constructor
+          *
+          * \post the solver is constructed without a factorization
+        */
+        Fixed_Mesh_Solver();
+
+        /*! Performs the banded Cholesky decomposition of `matrix` followed by substitution
+          *
+          * \param matrix the matrix to perform Cholesky decomposition
+          * \param vec the solution vector that is paired with `matrix`
+          * \return a vector x representing the solution of matrix * x = vec
+          *
+          * \pre see `factorize` and `substitute`
+          * \post (see return)
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        Vector<T> solve(const Base_Matrix<T>& matrix, Vector<T> vec);
+
+        /*! Performs the banded Cholesky decomposition of `matrix` and stores L
+          *
+          * Only entries within `band` of the diagonal are read.
+          *
+          * \param matrix the matrix to factor
+          *
+          * \pre matrix.get_size() == unknowns
+          * \pre matrix is symmetric positive definite with half bandwidth at most `band` (any mesh stencil)
+          * \post the factor of `matrix` is stored
+          * \throws domain_error thrown if the size is wrong or the matrix is not positive definite
+        */
+        void factorize(const Base_Matrix<T>& matrix);
+
+        /*! Solves L * L* * x = rhs using the stored factor, without virtual calls or heap allocation
+          *
+          * \param rhs the `unknowns` entries of the right hand side
+          * \param x receives the `unknowns` entries of the solution (may be `rhs`)
+          *
+          * \pre `factorize` has been called
+          * \post x holds the solution
+        */
+        void solve(const T* rhs, T* x) const;
+
+        /*! Solves L * L* * x = vec using the stored factor
+          *
+          * \param vec the right hand side
+          * \return a vector x representing the solution of matrix * x = vec
+          *
+          * \pre `factorize` has been called
+          * \pre vec.get_size() == unknowns
+          * \post (see return)
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        Vector<T> substitute(Vector<T> vec) const;
+
+        /*! Solves L * L* * x = b for SIMD_LANES interleaved right hand sides in place, every
+          * substitution step running across all lanes (see Solver_Strategy)
+          *
+          * \pre `factorize` has been called
+          * \pre size matches the size of the factored matrix
+          * \post `block` holds the interleaved solutions
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        void substitute_interleaved(T* block, const int& size) const;
+
+        /*! Gets the number of values in the band of L (unknowns * (band + 1)) */
+        size_t get_factor_count() const { return size_t(unknowns) * size_t(band + 1); }
+
+        /*! Gets the estimated floating point operations of `factorize` (2 n b^2 for n unknowns and half bandwidth b) */
+        double get_factor_flops() const { return 2.0 * double(unknowns) * double(band) * double(band); }
+
+        /*! Gets the estimated floating point operations of one `substitute` (4 n b) */
+        double get_substitute_flops() const { return 4.0 * double(unknowns) * double(band); }
+
+        /*! Copies the band of L, row by row, into `factor`
+          *
+          * \pre `factorize` has been called and `factor` holds get_factor_count() elements
+          * \post `factor` holds the band of L
+        */
+        void export_factor(T* factor) const;
+
+        /*! Restores the band of L from values written by `export_factor`
+          *
+          * \pre `factor` was exported from a factorization of `matrix`
+          * \post the factor of `matrix` is stored
+          * \throws domain_error thrown if `count` or the size of `matrix` does not fit M
+        */
+        void import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count);
+};
+
+/*! Creates the fixed-size solver for a mesh length
+  *
+  * \param mesh_length the mesh length
+  * \return a new `Fixed_Mesh_Solver<T, mesh_length>` (owned by the caller), or nullptr if
+  *         mesh_length is outside 2 to FIXED_MESH_LIMIT
+  *
+  * \post (see return)
+*/
+template <class T>
+Solver_Strategy<T>* make_fixed_mesh_solver(const int& mesh_length);
+
+/*! A `Fixed_Mesh_Solver` reached without the `Solver_Strategy` interface: `solve(solver, rhs, x)`
+ *  calls `Fixed_Mesh_Solver<T, M>::solve(rhs, x)` on the solver for its M
+ */
+template <class T>
+struct Fixed_Mesh_Kernel {
+    const void* solver;                                     //!< the `Fixed_Mesh_Solver<T, M>`, nullptr if none
+    void (*solve)(const void* solver, const T* rhs, T* x);  //!< forwards to its `solve(const T*, T*)`
+};
+
+/*! Gets the non-virtual entry point of a strategy made by `make_fixed_mesh_solver`
+  *
+  * \param method the strategy (may be nullptr)
+  * \param mesh_length the mesh length `method` was made for
+  * \return the kernel of `method`, or one with a nullptr solver if `method` is not a
+  *         `Fixed_Mesh_Solver<T, mesh_length>`
+  *
+  * \post (see return)
+*/
+template <class T>
+Fixed_Mesh_Kernel<T> get_fixed_mesh_kernel(const Solver_Strategy<T>* method, const int& mesh_length);
+
+#include "fixed_mesh_solver.hpp"
+#endif
@@ -0,0 +1,219 @@
+/*! \file
+ *  Function definitions for the `Fixed_Mesh_Solver` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <class T, int M>
+const int Fixed_Mesh_Solver<T, M>::unknowns;
+
+template <class T, int M>
+const int Fixed_Mesh_Solver<T, M>::band;
+
+template <class T, int M>
+Fixed_Mesh_Solver<T, M>::Fixed_Mesh_Solver() : m_factored(false) {
+    for (int i = 0; i < unknowns + 2 * band; i++) {
+        for (int k = 0; k <= band; k++) { m_factor[i][k] = 0; }
+    }
+    for (int i = 0; i < unknowns; i++) { m_inverse_diagonal[i] = 0; }
+}
+
+template <class T, int M>
+Vector<T> Fixed_Mesh_Solver<T, M>::solve(const Base_Matrix<T>& matrix, Vector<T> vec) {
+    if (matrix.get_size() != vec.get_size()) { throw domain_error("Error: Matrix and vector to be solved must be of same size."); }
+
+    factorize(matrix);
+
+    return substitute(vec);
+}
+
+template <class T, int M>
+void Fixed_Mesh_Solver<T, M>::factorize(const Base_Matrix<T>& matrix) {
+    if (matrix.get_size() != unknowns) { throw domain_error("Error: Matrix size does not match the fixed mesh solver."); }
+
+    m_factored = false;
+    for (int i = 0; i < unknowns; i++) {
+        T* row = m_factor[band + i];
+
+        // L(i, j) = (A(i, j) - sum over p < j of L(i, p) * L(j, p)) / L(j, j), for j = i - k
+        for (int k = band; k >= 1; k--) {
+            if (i - k < 0) { row[k] = 0; continue; }
+
+            const T* pivot_row = m_factor[band + i - k];
+            T sum = matrix.get_element(i, i - k);
+            for (int l = 1; k + l <= band; l++) { sum -= row[k + l] * pivot_row[l]; }
+            row[k] = sum * m_inverse_diagonal[i - k];
+        }
+
+        T dividend = matrix.get_element(i, i);
+        for (int k = 1; k <= band; k++) { dividend -= row[k] * row[k]; }
+        if (!(dividend > 0)) { throw domain_error("Error: Imaginary numbers are about to run amok while solving a symmetric matrix."); }
+
+        row[0] = sqrt(dividend);
+        m_inverse_diagonal[i] = T(1) / row[0];
+    }
+    m_factored = true;
+
+    return;
+}
+
+template <class T, int M>
+void Fixed_Mesh_Solver<T, M>::solve(const T* rhs, T* x) const {
+    // Zero padding on both sides stands in for the entries outside the mesh
+    T work[unknowns + 2 * band];
+    for (int k = 0; k < band; k++) {
+        work[k] = 0;
+        work[band + unknowns + k] = 0;
+    }
+
+    // Forward substitution (L * y = rhs)
+    for (int i = 0; i < unknowns; i++) {
+        const T* row = m_factor[band + i];
+        T sum = rhs[i];
+        for (int k = 1; k <= band; k++) { sum -= row[k] * work[band + i - k]; }
+        work[band + i] = sum * m_inverse_diagonal[i];
+    }
+
+    // Back substitution (L* * x = y), reading L column-wise
+    for (int i = unknowns - 1; i >= 0; i--) {
+        T sum = work[band + i];
+        for (int k = 1; k <= band; k++) { sum -= m_factor[band + i + k][k] * work[band + i + k]; }
+        work[band + i] = sum * m_inverse_diagonal[i];
+    }
+
+    for (int i = 0; i < unknowns; i++) { x[i] = work[band + i]; }
+
+    return;
+}
+
+template <class T, int M>
+Vector<T> Fixed_Mesh_Solver<T, M>::substitute(Vector<T> vec) const {
+    if (!m_factored || vec.get_size() != unknowns) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    solve(vec.get_ptr(), vec.get_ptr());
+
+    return vec;
+}
+
+template <class T, int M>
+void Fixed_Mesh_Solver<T, M>::substitute_interleaved(T* block, const int& size) const {
+    if (!m_factored || size != unknowns) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    T work[unknowns + 2 * band][SIMD_LANES];
+    for (int k = 0; k < band; k++) {
+        for (int l = 0; l < SIMD_LANES; l++) {
+            work[k][l] = 0;
+            work[band + unknowns + k][l] = 0;
+        }
+    }
+
+    for (int i = 0; i < unknowns; i++) {
+        const T* row = m_factor[band + i];
+        T sum[SIMD_LANES];
+        for (int l = 0; l < SIMD_LANES; l++) { sum[l] = block[i * SIMD_LANES + l]; }
+        for (int k = 1; k <= band; k++) {
+            for (int l = 0; l < SIMD_LANES; l++) { sum[l] -= row[k] * work[band + i - k][l]; }
+        }
+        for (int l = 0; l < SIMD_LANES; l++) { work[band + i][l] = sum[l] * m_inverse_diagonal[i]; }
+    }
+
+    for (int i = unknowns - 1; i >= 0; i--) {
+        T sum[SIMD_LANES];
+        for (int l = 0; l < SIMD_LANES; l++) { sum[l] = work[band + i][l]; }
+        for (int k = 1; k <= band; k++) {
+            T factor = m_factor[band + i + k][k];
+            for (int l = 0; l < SIMD_LANES; l++) { sum[l] -= factor * work[band + i + k][l]; }
+        }
+        for (int l = 0; l < SIMD_LANES; l++) {
+            work[band + i][l] = sum[l] * m_inverse_diagonal[i];
+            block[i * SIMD_LANES + l] = work[band + i][l];
+        }
+    }
+
+    return;
+}
+
+template <class T, int M>
+void Fixed_Mesh_Solver<T, M>::export_factor(T* factor) const {
+    for (int i = 0; i < unknowns; i++) {
+        factor = copy(m_factor[band + i], m_factor[band + i] + band + 1, factor);
+    }
+
+    return;
+}
+
+template <class T, int M>
+void Fixed_Mesh_Solver<T, M>::import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count) {
+    if (matrix.get_size() != unknowns || count != get_factor_count()) { throw domain_error("Error: Stored factor does not match the size of the matrix."); }
+
+    for (int i = 0; i < unknowns; i++) {
+        copy(factor, factor + band + 1, m_factor[band + i]);
+        factor += band + 1;
+        m_inverse_diagonal[i] = T(1) / m_factor[band + i][0];
+    }
+    m_factored = true;
+
+    return;
+}
+
+template <class T>
+Solver_Strategy<T>* make_fixed_mesh_solver(const int& mesh_length) {
+    switch (mesh_length) {
+        case 2: return new Fixed_Mesh_Solver<T, 2>();
+        case 3: return new Fixed_Mesh_Solver<T, 3>();
+        case 4: return new Fixed_Mesh_Solver<T, 4>();
+        case 5: return new Fixed_Mesh_Solver<T, 5>();
+        case 6: return new Fixed_Mesh_Solver<T, 6>();
+        case 7: return new Fixed_Mesh_Solver<T, 7>();
+        case 8: return new Fixed_Mesh_Solver<T, 8>();
+        case 9: return new Fixed_Mesh_Solver<T, 9>();
+        case 10: return new Fixed_Mesh_Solver<T, 10>();
+        case 11: return new Fixed_Mesh_Solver<T, 11>();
+        case 12: return new Fixed_Mesh_Solver<T, 12>();
+        case 13: return new Fixed_Mesh_Solver<T, 13>();
+        case 14: return new Fixed_Mesh_Solver<T, 14>();
+        case 15: return new Fixed_Mesh_Solver<T, 15>();
+        case 16: return new Fixed_Mesh_Solver<T, 16>();
+        default: return nullptr;
+    }
+}
+
+template <class T, int M>
+void fixed_mesh_kernel_solve(const void* solver, const T* rhs, T* x) {
+    static_cast<const Fixed_Mesh_Solver<T, M>*>(solver)->solve(rhs, x);
+
+    return;
+}
+
+template <class T, int M>
+Fixed_Mesh_Kernel<T> make_fixed_mesh_kernel(const Solver_Strategy<T>* method) {
+    // The strategy is a virtual base, so the solver is found once here rather than on every solve
+    Fixed_Mesh_Kernel<T> kernel = { dynamic_cast<const Fixed_Mesh_Solver<T, M>*>(method), &fixed_mesh_kernel_solve<T, M> };
+
+    return kernel;
+}
+
+template <class T>
+Fixed_Mesh_Kernel<T> get_fixed_mesh_kernel(const Solver_Strategy<T>* method, const int& mesh_length) {
+    switch (mesh_length) {
+        case 2: return make_fixed_mesh_kernel<T, 2>(method);
+        case 3: return make_fixed_mesh_kernel<T, 3>(method);
+        case 4: return make_fixed_mesh_kernel<T, 4>(method);
+        case 5: return make_fixed_mesh_kernel<T, 5>(method);
+        case 6: return make_fixed_mesh_kernel<T, 6>(method);
+        case 7: return make_fixed_mesh_kernel<T, 7>(method);
+        case 8: return make_fixed_mesh_kernel<T, 8>(method);
+        case 9: return make_fixed_mesh_kernel<T, 9>(method);
+        case 10: return make_fixed_mesh_kernel<T, 10>(method);
+        case 11: return make_fixed_mesh_kernel<T, 11>(method);
+        case 12: return make_fixed_mesh_kernel<T, 12>(method);
+        case 13: return make_fixed_mesh_kernel<T, 13>(method);
+        case 14: return make_fixed_mesh_kernel<T, 14>(method);
+        case 15: return make_fixed_mesh_kernel<T, 15>(method);
+        case 16: return make_fixed_mesh_kernel<T, 16>(method);
+        default: {
+            Fixed_Mesh_Kernel<T> none = { nullptr, nullptr };
+            return none;
+        }
+    }
+}
@@ -7,6 +7,10 @@
 #ifndef GAUSSIAN_SOLVER_H
 #define GAUSSIAN_SOLVER_H
 #include "solver_strategy.h"
+#include "task_scheduler.h"
+
+/*! Number of trailing rows updated per task during elimination */
+const int TRAILING_ROW_GRAIN = 32;
 
 /*! Gaussian solver class */
 template <class T>
@@ -17,7 +21,14 @@ class Gaussian_Solver : public virtual Solver_Strategy<T> {
         Vector<T> m_scales;
         Vector<T> m_ratios;
 
+        // Row operations recorded by `factorize` so they can be replayed on new vectors
+        Vector<Vector<T>> m_multipliers;
+        const Base_Matrix<T>* m_source;
+
     public:
+        /*! Constructs a solver with no stored factorization */
+        Gaussian_Solver() : m_size(0), m_source(nullptr) {}
+
         /*! Function operator overload implementing Gaussian elimination with scaled partial pivoting
           *
           * \param matrix the matrix to perform gaussian elimination on
@@ -31,6 +42,63 @@ class Gaussian_Solver : public virtual Solver_Strategy<T> {
         */
         virtual Vector<T> solve(const Base_Matrix<T>& matrix, Vector<T> vec);
 
+        /*! Row reduces `matrix` once and records the row operations for later substitutions
+          *
+          * \param matrix the matrix to perform gaussian elimination on
+          * 
+          * \pre pre-conditions for auxiliary functions should be met
+          * \pre `matrix` outlives this solver (its back substitution is used by `substitute`)
+          * \post the row-reduced matrix and the row operation multipliers are stored
+        */
+        virtual void factorize(const Base_Matrix<T>& matrix);
+
+        /*! Replays the recorded row operations on `vec` and back substitutes
+          *
+          * \param vec the right hand side
+          * \return a vector x representing the solution of matrix * x = vec
+          * 
+          * \pre `factorize` has been called
+          * \pre vec.get_size() matches the size of the factored matrix
+          * \post (see return)
+          * \throws domain_error thrown if pre-conditions are broken
+        */
+        virtual Vector<T> substitute(Vector<T> vec) const;
+
+        /*! Replays the recorded row operations and back substitutes for SIMD_LANES interleaved right
+          * hand sides in place, every step running across all lanes (see Solver_Strategy)
+          *
+          * \pre `factorize` has been called
+          * \pre size matches the size of the factored matrix
+          * \post `block` holds the interleaved solutions
+          * \throws domain_error thrown if pre-conditions are broken or division by zero occurs
+        */
+        virtual void substitute_interleaved(T* block, const int& size) const;
+
+        /*! Gets the number of values in the reduced rows followed by the recorded multipliers */
+        virtual size_t get_factor_count() const;
+
+        /*! Gets the estimated floating point operations of `factorize` (2 n^3 / 3) */
+        virtual double get_factor_flops() const { return 2.0 * double(m_size) * double(m_size) * double(m_size) / 3; }
+
+        /*! Gets the estimated floating point operations of one `substitute` (2 n^2) */
+        virtual double get_substitute_flops() const { return 2.0 * double(m_size) * double(m_size); }
+
+        /*! Copies the reduced rows and then the multipliers of every row (columns 0 to row - 1) into `factor`
+          *
+          * \pre `factorize` has been called and `factor` holds get_factor_count() elements
+          * \post `factor` holds the factorization
+        */
+        virtual void export_factor(T* factor) const;
+
+        /*! Restores the reduced rows and multipliers from values written by `export_factor`
+          *
+          * \pre `factor` was exported from a factorization of `matrix`
+          * \pre `matrix` outlives the use of the factorization (it is used for back substitution)
+          * \post the strategy is factored as if `factorize(matrix)` had been called
+          * \throws domain_error thrown if `count` does not fit `matrix`
+        */
+        virtual void import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count);
+
         // Class specific functions
         /*! Computes the scaling vector (max absolute elements of each row) (auxiliary function used for scaled partial pivoting)
           * 
@@ -68,13 +136,15 @@ class Gaussian_Solver : public virtual Solver_Strategy<T> {
         /*! Reduce below row/column `row_col`  (auxiliary function)
           * 
           * \param row_col the entry in the diagonal that we are about to row reduce 
-          * \param vec the vector that is being used in tandem with the matrix for gaussian elimination
           * 
           * \pre (==) operator defined for type T and numeric value '0'
           * \pre (/) operator defined for type T
           * \post all elements in matrix below diagonal entry `row_col` are "zeroed" out and the rows are updated by the rules of gaussian elimination 
+          *       (the rows are updated concurrently on the default scheduler)
+          * \post the multiplier used for every reduced row is recorded in `m_multipliers`
+          * \throws std::domain_error is thrown if the pivot is zero
         */
-        void row_reduce(const int& row_col, Vector<T>& vec);
+        void row_reduce(const int& row_col);
 };
 
 #include "gaussian_solver.hpp"
@@ -6,10 +6,28 @@
 
 template <typename T>
 Vector<T> Gaussian_Solver<T>::solve(const Base_Matrix<T>& matrix, Vector<T> vec) {
+    if (matrix.get_size() != vec.get_size()) { throw domain_error("Error: Matrix and vector to be solved must be of same size."); }
+
+    factorize(matrix);
+
+    return substitute(vec);
+}
+
+template <typename T>
+void Gaussian_Solver<T>::factorize(const Base_Matrix<T>& matrix) {
     m_size = matrix.get_size();
     m_matrix_data = matrix.get_elements();
+    m_source = &matrix;
+
+    if (this->m_control != nullptr) { this->m_control->check(); }
+
+    m_multipliers.clear();
+    for (int row = 0; row < m_size; row++) {
+        m_multipliers.push_back(Vector<T>(row, 0));
+    }
 
     // Calculate scaling vector
+    m_scales.clear();
     calculate_scales();
 
     // Perform Gaussian elimination with scaled partial pivoting
@@ -20,18 +38,112 @@ Vector<T> Gaussian_Solver<T>::solve(const Base_Matrix<T>& matrix, Vector<T> vec)
         //rearrange(row_col, vec);
 
         // Zero out all elements in column below diagonal row_col
-        row_reduce(row_col, vec);
+        row_reduce(row_col);
 
+        if (this->m_control != nullptr) {
+            this->m_control->check();
+            this->m_control->set_progress(double(row_col + 1) / m_size);
+        }
     }
 
-    // Debug
-    /*int j = 0;
-    for (int i = 0; i < m_size; i++) {
-        cout << m_matrix_data[i][j] << endl;
-        j++;
-    }*/
+    return;
+}
 
-    return matrix.back_sub(m_matrix_data, vec);
+template <typename T>
+Vector<T> Gaussian_Solver<T>::substitute(Vector<T> vec) const {
+    if (m_source == nullptr || m_size != vec.get_size()) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    // Apply the row operations of the elimination in the order they were performed
+    for (int row_col = 0; row_col < m_size; row_col++) {
+        for (int runner = row_col + 1; runner < m_size; runner++) {
+            T common_factor = m_multipliers[runner][row_col];
+            if (common_factor == 0) { continue; }
+            vec[runner] -= common_factor * vec[row_col];
+        }
+    }
+
+    return m_source->back_sub(m_matrix_data, vec);
+}
+
+template <typename T>
+void Gaussian_Solver<T>::substitute_interleaved(T* block, const int& size) const {
+    if (m_source == nullptr || m_size != size) { throw domain_error("Error: Substitution requires a factored matrix of same size as the vector."); }
+
+    // Only full row-reduced rows can be substituted here; other storage goes through the source matrix lane by lane
+    if (m_size > 0 && m_matrix_data[0].get_size() != m_size) {
+        Solver_Strategy<T>::substitute_interleaved(block, size);
+        return;
+    }
+
+    const int lanes = SIMD_LANES;
+    for (int row_col = 0; row_col < m_size; row_col++) {
+        const T* pivot = block + row_col * lanes;
+        for (int runner = row_col + 1; runner < m_size; runner++) {
+            T common_factor = m_multipliers[runner][row_col];
+            if (common_factor == 0) { continue; }
+            vector_interleaved_update<lanes>(&common_factor, 1, pivot, block + runner * lanes);
+        }
+    }
+
+    for (int row = m_size - 1; row >= 0; row--) {
+        const T* reduced_row = m_matrix_data[row].get_ptr();
+        if (reduced_row[row] == 0) { throw domain_error("Error: Division by zero during back substitution."); }
+
+        T sum[lanes];
+        for (int l = 0; l < lanes; l++) { sum[l] = block[row * lanes + l]; }
+
+        vector_interleaved_update<lanes>(reduced_row + row + 1, m_size - row - 1, block + (row + 1) * lanes, sum);
+
+        for (int l = 0; l < lanes; l++) { block[row * lanes + l] = sum[l] / reduced_row[row]; }
+    }
+
+    return;
+}
+
+template <typename T>
+size_t Gaussian_Solver<T>::get_factor_count() const {
+    size_t count = size_t(m_size) * size_t(m_size - 1) / 2;
+    for (int row = 0; row < m_matrix_data.get_size(); row++) { count += size_t(m_matrix_data[row].get_size()); }
+
+    return count;
+}
+
+template <typename T>
+void Gaussian_Solver<T>::export_factor(T* factor) const {
+    for (int row = 0; row < m_matrix_data.get_size(); row++) {
+        factor = copy(m_matrix_data[row].get_ptr(), m_matrix_data[row].get_ptr() + m_matrix_data[row].get_size(), factor);
+    }
+    for (int row = 0; row < m_size; row++) {
+        factor = copy(m_multipliers[row].get_ptr(), m_multipliers[row].get_ptr() + row, factor);
+    }
+
+    return;
+}
+
+template <typename T>
+void Gaussian_Solver<T>::import_factor(const Base_Matrix<T>& matrix, const T* factor, const size_t& count) {
+    // The stored rows have the shape of the matrix's own rows
+    Vector<Vector<T>> matrix_data = matrix.get_elements();
+    size_t expected = size_t(matrix.get_size()) * size_t(matrix.get_size() - 1) / 2;
+    for (int row = 0; row < matrix_data.get_size(); row++) { expected += size_t(matrix_data[row].get_size()); }
+    if (count != expected) { throw domain_error("Error: Stored factor does not match the size of the matrix."); }
+
+    for (int row = 0; row < matrix_data.get_size(); row++) {
+        copy(factor, factor + matrix_data[row].get_size(), matrix_data[row].get_ptr());
+        factor += matrix_data[row].get_size();
+    }
+
+    m_size = matrix.get_size();
+    m_multipliers.clear();
+    for (int row = 0; row < m_size; row++) {
+        m_multipliers.push_back(Vector<T>(row, 0));
+        copy(factor, factor + row, m_multipliers[row].get_ptr());
+        factor += row;
+    }
+    m_matrix_data = matrix_data;
+    m_source = &matrix;
+
+    return;
 }
 
 template <typename T>
@@ -80,13 +192,17 @@ void Gaussian_Solver<T>::rearrange(const int& current_row, Vector<T>& vec) {
 }
 
 template <typename T>
-void Gaussian_Solver<T>::row_reduce(const int& row_col, Vector<T>& vec) {
-    for (int runner = row_col + 1; runner < m_size; runner++) {
-        if (m_matrix_data[runner][row_col] == 0) { continue; }
-        T common_factor = m_matrix_data[row_col][row_col] / m_matrix_data[runner][row_col];
-        m_matrix_data[runner] = m_matrix_data[runner] * (-common_factor) + m_matrix_data[row_col];
-        vec[runner] = vec[runner] * (-common_factor) + vec[row_col];
-    }
+void Gaussian_Solver<T>::row_reduce(const int& row_col) {
+    if (m_matrix_data[row_col][row_col] == 0) { throw domain_error("Error: Zero pivot during gaussian elimination."); }
+
+    // Every trailing row only reads the pivot row, so the rows are updated concurrently. The pivot row is
+    // subtracted as is (the trailing row is not rescaled), so entries cannot grow geometrically with the size
+    default_scheduler().parallel_for(row_col + 1, m_size, [this, row_col](int runner) {
+        if (m_matrix_data[runner][row_col] == 0) { return; }
+        T common_factor = m_matrix_data[runner][row_col] / m_matrix_data[row_col][row_col];
+        m_matrix_data[runner].axpy(-common_factor, m_matrix_data[row_col]);
+        m_multipliers[runner][row_col] = common_factor;
+    }, TRAILING_ROW_GRAIN);
 
     return;
 }
\ No newline at end of file
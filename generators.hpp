@@ -4,134 +4,283 @@
 
 //Programmers: Zachary Bahr and Jacob LeGrand
 
-/*! Determines which boundary function to be called when generating the b vector
+/*! Finite difference stencil used to discretize the Laplacian
+ *
+ *  `five_point` is the standard second order stencil. `nine_point` is the fourth order
+ *  compact (Mehrstellen) stencil, which also couples each point to its 4 corner neighbours.
+ */
+enum Stencil { five_point, nine_point };
+
+/*! Batched boundary function: evaluates one edge of the mesh in a single call
+*
+*  `values[k]` is set to the boundary value at (`x[k]`, `y[k]`) for k = 0 to count - 1.
+*  Passing a whole edge at once lets the function vectorize its loop and amortize any
+*  setup (e.g. for special functions) over the edge.
+*/
+typedef void (*Batch_Boundary)(const double* x, const double* y, double* values, const int count);
+
+/*! Generate the padded grid of a mesh: (mesh_length + 1)^2 points, x fastest, with the boundary values
+*  on the outer ring (ghost cells) and zeros inside (see Stencil_Operator_2D)
+*
+*  Each ring point is evaluated exactly once (4 * mesh_length calls), by the function owning its edge:
+*  the left edge owns both left corners, the lower and right edges own the remaining corners.
+*  The boundary functions may be function pointers, lambdas or any other callables taking (x, y);
+*  they are called directly, so callables with a visible body are inlined.
 *
-*  \param x the x value to be calculated
-*  \param y the y value to be calculated
 *  \param lower_bound the lower bound of the mesh
 *  \param upper_bound the upper bound of the mesh
-*  \param *upper a pointer to the upper boundary function
-*  \param *lower a pointer to the lower boundary function
-*  \param *right a pointer to the right boundary function
-*  \param *left a pointer to the left boundary function
-*  \return a value calculated from plugging x and y into the appropriate boundary function, or 0 if no boundary function is applicable
+*  \param mesh_length the length of the mesh
+*  \param upper the upper boundary function
+*  \param lower the lower boundary function
+*  \param right the right boundary function
+*  \param left the left boundary function
+*  \return the padded grid
 * 
 *  \pre upper_bound > lower_bound
+*  \pre mesh_length > 0
+*  \pre each boundary function is callable as double(double, double)
 *  \post (see return)
 *  \relates Matrix_Solver
 */
-double boundary_func(const double x, const double y, const double lower_bound, const double upper_bound, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double)) {
-    double result;
+template <typename T, typename Upper, typename Lower, typename Right, typename Left>
+Vector<T> gen_padded_boundary(const double lower_bound, const double upper_bound, const int mesh_length, const Upper& upper, const Lower& lower, const Right& right, const Left& left) {
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    int stride = grid.get_padded_length();
+    Vector<T> padded(stride * stride, 0);
+    T* data = padded.get_ptr();
+    double low = grid.get_coordinate(0);
+    double high = grid.get_coordinate(mesh_length);
 
-    if (x == lower_bound) result = left(x, y);
-    else if (y == lower_bound) result = lower(x, y);
-    else if (x == upper_bound) result = right(x, y);
-    else if (y == upper_bound) result = upper(x, y);
-    else result = 0;
+    for (int k = 0; k <= mesh_length; k++) {
+        data[k * stride] = T(left(low, grid.get_coordinate(k)));
+    }
+    for (int k = 1; k <= mesh_length; k++) {
+        double coordinate = grid.get_coordinate(k);
+        data[k] = T(lower(coordinate, low));
+        data[k * stride + mesh_length] = T(right(high, coordinate));
+    }
+    for (int k = 1; k < mesh_length; k++) {
+        data[mesh_length * stride + k] = T(upper(grid.get_coordinate(k), high));
+    }
 
-    return result;
+    return padded;
 }
 
-/*! Sum up the U (phi) values for all 4 points a distance of delta away from (x, y) in the mesh
+/*! Generate the padded grid of a mesh (see above) from batched boundary functions
+*
+*  Each boundary function is called exactly once, with every ring point of its edge
+*  (same corner ownership as the pointwise overload).
 *
-*  \param x the x value to be calculated
-*  \param y the y value to be calculated
 *  \param lower_bound the lower bound of the mesh
 *  \param upper_bound the upper bound of the mesh
-*  \param delta the value of upper_bound/mesh_length
-*  \param *upper a pointer to the upper boundary function
-*  \param *lower a pointer to the lower boundary function
-*  \param *right a pointer to the right boundary function
-*  \param *left a pointer to the left boundary function
-*  \return the sum of all the U (phi) values for all 4 points a distance away from (x, y) in the mesh
+*  \param mesh_length the length of the mesh
+*  \param upper the batched upper boundary function
+*  \param lower the batched lower boundary function
+*  \param right the batched right boundary function
+*  \param left the batched left boundary function
+*  \return the padded grid
 * 
 *  \pre upper_bound > lower_bound
-*  \pre T_function is defined for (double, double, double, double, double (double, double), double (double, double), double (double, double), double (double, double))
+*  \pre mesh_length > 0
 *  \post (see return)
 *  \relates Matrix_Solver
 */
-template <double T_Function(double, double, double, double, double (double, double), double (double, double), double (double, double), double (double, double))>
-double callback(const double x, const double y, const double delta, const double lower_bound, const double upper_bound, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double)) {
-    double sum = T_Function(x + delta, y, lower_bound, upper_bound, upper, lower, right, left) 
-               + T_Function(x - delta, y, lower_bound, upper_bound, upper, lower, right, left) 
-               + T_Function(x, y + delta, lower_bound, upper_bound, upper, lower, right, left) 
-               + T_Function(x, y - delta, lower_bound, upper_bound, upper, lower, right, left);
-    return sum;
+template <typename T>
+Vector<T> gen_padded_boundary(const double lower_bound, const double upper_bound, const int mesh_length, Batch_Boundary upper, Batch_Boundary lower, Batch_Boundary right, Batch_Boundary left) {
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    int stride = grid.get_padded_length();
+    Vector<T> padded(stride * stride, 0);
+    T* data = padded.get_ptr();
+    double low = grid.get_coordinate(0);
+    double high = grid.get_coordinate(mesh_length);
+
+    // Coordinates along an edge (0 to mesh_length), the fixed coordinate and the returned values
+    Vector<double> along(stride, 0), fixed(stride, low), values(stride, 0);
+    for (int k = 0; k <= mesh_length; k++) {
+        along[k] = grid.get_coordinate(k);
+    }
+
+    left(fixed.get_ptr(), along.get_ptr(), values.get_ptr(), stride);
+    for (int k = 0; k <= mesh_length; k++) data[k * stride] = T(values[k]);
+
+    lower(along.get_ptr() + 1, fixed.get_ptr(), values.get_ptr(), mesh_length);
+    for (int k = 1; k <= mesh_length; k++) data[k] = T(values[k - 1]);
+
+    fixed = high;
+    right(fixed.get_ptr(), along.get_ptr() + 1, values.get_ptr(), mesh_length);
+    for (int k = 1; k <= mesh_length; k++) data[k * stride + mesh_length] = T(values[k - 1]);
+
+    upper(along.get_ptr() + 1, fixed.get_ptr(), values.get_ptr(), mesh_length - 1);
+    for (int k = 1; k < mesh_length; k++) data[mesh_length * stride + k] = T(values[k - 1]);
+
+    return padded;
+}
+
+/*! Generate the b vector to be used in Ax=b from a padded grid holding the boundary values
+*
+*  For the 5-point stencil b is read off the stencil applied to the padded grid (A * 0 - b).
+*  For the 9-point stencil each interior point weighs its edge (4/20) and corner (1/20) neighbours
+*  on the ring. Mesh rows are assembled concurrently on the default scheduler.
+*
+*  \param mesh_length the length of the mesh
+*  \param padded the padded grid (see gen_padded_boundary)
+*  \param stencil the stencil the b vector is assembled for (corner neighbours are included for `nine_point`)
+*  \return the generated b vector
+* 
+*  \pre mesh_length > 1
+*  \pre padded.get_size() == (mesh_length + 1)^2 and its interior is zero
+*  \post (see return)
+*  \throws domain_error thrown if padded is not sized for the mesh
+*  \relates Matrix_Solver
+*/
+template <typename T>
+Vector<T> gen_callback_vec(const int mesh_length, const Vector<T>& padded, const Stencil stencil = five_point) {
+    int stride = mesh_length + 1;
+    if (padded.get_size() != stride * stride) { throw domain_error("Error: Padded grid must have (mesh_length + 1)^2 entries."); }
+
+    if (stencil == five_point) {
+        Stencil_Operator_2D<T> op(mesh_length);
+        Vector<T> residual(padded);
+        op.apply_padded(padded.get_ptr(), residual.get_ptr());
+
+        return -op.unpad(residual);
+    }
+
+    int row_length = mesh_length - 1;
+    Vector<T> vec(row_length * row_length, 0);
+    T* data = vec.get_ptr();
+    const T* grid = padded.get_ptr();
+
+    default_scheduler().parallel_for(1, mesh_length, [&](int j) {
+        T* row = data + (j - 1) * row_length;
+        const T* below = grid + (j - 1) * stride;
+        const T* middle = grid + j * stride;
+        const T* above = grid + (j + 1) * stride;
+
+        // Mehrstellen weights: 4/20 for the edge neighbours, 1/20 for the corners
+        for (int i = 1; i < mesh_length; i++) {
+            row[i - 1] = T(0.2) * (((middle[i + 1] + middle[i - 1]) + above[i]) + below[i])
+                       + T(0.05) * (((above[i + 1] + above[i - 1]) + below[i + 1]) + below[i - 1]);
+        }
+    });
+
+    return vec;
 }
 
 /*! Generate the b vector to be used in Ax=b
 *
+*  The boundary is evaluated once into the ghost ring of a padded grid (see gen_padded_boundary)
+*  and b is assembled from the ring.
+*
 *  \param lower_bound the lower bound of the mesh
 *  \param upper_bound the upper bound of the mesh
 *  \param mesh_length the length of the mesh
-*  \param upper a pointer to the upper boundary function
-*  \param lower a pointer to the lower boundary function
-*  \param right a pointer to the right boundary function
-*  \param left a pointer to the left boundary function
+*  \param upper the upper boundary function (pointwise callable or Batch_Boundary)
+*  \param lower the lower boundary function (pointwise callable or Batch_Boundary)
+*  \param right the right boundary function (pointwise callable or Batch_Boundary)
+*  \param left the left boundary function (pointwise callable or Batch_Boundary)
+*  \param stencil the stencil the b vector is assembled for (corner neighbours are included for `nine_point`)
 *  \return the generated b vector
 * 
 *  \pre upper_bound > lower_bound
+*  \pre mesh_length > 1
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+template <typename T, typename Upper, typename Lower, typename Right, typename Left>
+Vector<T> gen_callback_vec(const double lower_bound, const double upper_bound, const int mesh_length, const Upper& upper, const Lower& lower, const Right& right, const Left& left, const Stencil stencil = five_point) {
+    return gen_callback_vec<T>(mesh_length, gen_padded_boundary<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left), stencil);
+}
+
+/*! Generate the fourth order compact (Mehrstellen) coefficient matrix A to be used in Ax=b
+*
+*  Every row is the 9-point stencil 20u - 4(edge neighbours) - (corner neighbours) scaled by 1/20,
+*  so the diagonal stays 1 as with the 5-point matrix.
+*
+*  \param mesh_length the length of the mesh
+*  \return a Symmetric_Matrix object that represents the coefficient A matrix
+* 
 *  \pre mesh_length > 0
-*  \pre push_back() is defined for Vector<T>
-*  \pre callback<boundary_function> returns a T value
 *  \post (see return)
 *  \relates Matrix_Solver
 */
 template <typename T>
-Vector<T> gen_callback_vec(const double lower_bound, const double upper_bound, const int mesh_length, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double)) {
-    Vector<T> vec((mesh_length - 1) * (mesh_length - 1));
-    double delta = upper_bound / mesh_length;
-
-    /* The ZERO_LIMIT (defined in libraries.h) is used to differentiate between y's and x's that are very, 
-       very close to the boundary. Without it, the vector is not generated with the correct size */
-    for (double y = lower_bound + delta; y < (upper_bound - ZERO_LIMIT); y += delta) {
-        for (double x = lower_bound + delta; x < (upper_bound - ZERO_LIMIT); x += delta) {
-            vec.push_back(callback<boundary_func>(x, y, delta, lower_bound, upper_bound, upper, lower, right, left));
+Symmetric_Matrix<T> gen_nine_point_matrix(const int& mesh_length)
+{
+    int row_length = mesh_length - 1;
+    int matrix_size = row_length * row_length;
+    Symmetric_Matrix<T> a(matrix_size, 0);
+
+    // Only the neighbours that come before i are set (rows hold columns 0 to i); the rest are implied by symmetry
+    default_scheduler().parallel_for(0, matrix_size, [&](int i) {
+        T* row = a.get_row_ref(i).get_ptr();
+        int col = i % row_length;
+
+        row[i] = 1;
+
+        if (col != 0)
+            row[i - 1] = T(-0.2);
+
+        if (i >= row_length)
+        {
+            row[i - row_length] = T(-0.2);
+
+            if (col != 0)
+                row[i - row_length - 1] = T(-0.05);
+            if (col != row_length - 1)
+                row[i - row_length + 1] = T(-0.05);
         }
-    }
+    });
 
-    return vec * 0.25;
+    return a;
 }
 
 /*! Generate the coefficient matrix A to be used in Ax=b
 *
+*  Rows are filled concurrently on the default scheduler by writing straight into the
+*  preallocated row storage.
+*
 *  \param mesh_length the length of the mesh
+*  \param stencil the stencil to discretize the Laplacian with
 *  \return a Symmetric_Matrix object that represents the coefficient A matrix
 * 
 *  \pre mesh_length > 0
-*  \pre set_element() is defined for Symmetric_Matrix<T>
-*  \pre callback<boundary_function> returns a T value
 *  \post (see return)
 *  \relates Matrix_Solver
 */
 template <typename T>
-Symmetric_Matrix<T> gen_coefficient_matrix(const int& mesh_length)
+Symmetric_Matrix<T> gen_coefficient_matrix(const int& mesh_length, const Stencil stencil = five_point)
 {
-    int matrix_size = (mesh_length - 1) * (mesh_length - 1);
+    if (stencil == nine_point) { return gen_nine_point_matrix<T>(mesh_length); }
+
+    int row_length = mesh_length - 1;
+    int matrix_size = row_length * row_length;
     Symmetric_Matrix<T> a(matrix_size, 0);
 
-    // Set top left corner before starting loop
-    a.set_element(0, 0, 1);
+    // Rows hold columns 0 to i, so only the neighbours before i are set
+    default_scheduler().parallel_for(0, matrix_size, [&](int i) {
+        T* row = a.get_row_ref(i).get_ptr();
 
-    for (int i = 1; i < matrix_size; i++)
-    {
         // Set the diagonal to 1
-        a.set_element(i, i, 1);
+        row[i] = 1;
 
         // Alternate between -upperlimit/mesh_length and 0 every certain number of elements
-        if (i % (mesh_length - 1) != 0)
-            a.set_element(i, i - 1, -0.25);
-        
+        if (i % row_length != 0)
+            row[i - 1] = T(-0.25);
+
         // Banded diagonals
-        if (i >= mesh_length-1)
-            a.set_element(i, i - (mesh_length - 1), -0.25);
-    }
+        if (i >= row_length)
+            row[i - row_length] = T(-0.25);
+    });
 
     return a;
 }
 
 /*! Write the x, y, and z values of our solution to a file, to be used with graphing
 *
+*  Blocks of mesh rows are formatted concurrently and written in order (see write_chunked_text), so
+*  the file is the same as formatting it line by line (see write_npy for the binary format).
+*
 *  \param lower_bound the lower bound of the mesh
 *  \param upper_bound the upper bound of the mesh
 *  \param mesh_length the length of the mesh
@@ -140,28 +289,36 @@ Symmetric_Matrix<T> gen_coefficient_matrix(const int& mesh_length)
 * 
 *  \pre upper_bound > lower_bound
 *  \pre mesh_length > 0
-*  \pre result is not an empty Vector
+*  \pre result has one entry per interior mesh point
 *  \post the x, y, and z values of our soltuion are written to a file
+*  \throws domain_error thrown if result is not sized for the mesh
+*  \throws runtime_error thrown if the file cannot be written
 *  \relates Matrix_Solver
 */
 template <typename T>
 void output_to_file(const double& lower_bound, const double& upper_bound, const int& mesh_length, const Vector<T>& result, const string& file_name) {
-    ofstream fout;
-    fout.open(file_name);
-
-    // Output data;
-    double delta = upper_bound / mesh_length;
-    int i = 0;
-    /* The ZERO_LIMIT (defined in libraries.h) is used to differentiate between y's and x's that are very, 
-    very close to the boundary. Without it, the vector is not generated with the correct size */
-    for (double y = lower_bound + delta; y < (upper_bound - ZERO_LIMIT); y += delta) {
-        for (double x = lower_bound + delta; x < (upper_bound - ZERO_LIMIT); x += delta) {
-            fout << x << "\t" << y << "\t" << result[i] << endl;
-            i++;
-        }
-    }
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    if (result.get_size() != grid.get_interior_count()) { throw domain_error("Error: Vector must have one entry per interior mesh point."); }
+
+    // Blocks of whole mesh rows are formatted concurrently and written in order
+    int rows_per_chunk = max(1, TEXT_CHUNK_LINES / grid.get_row_length());
+    int chunk_count = (grid.get_row_length() + rows_per_chunk - 1) / rows_per_chunk;
 
-    fout.close();
+    write_chunked_text(file_name, chunk_count, [&](int chunk, string& text) {
+        int first = grid.get_row_begin() + chunk * rows_per_chunk;
+        int last = min(grid.get_row_end(), first + rows_per_chunk);
+        for (int j = first; j < last; j++) {
+            double y = grid.get_coordinate(j);
+            for (int i = grid.get_row_begin(); i < grid.get_row_end(); i++) {
+                append_number(text, grid.get_coordinate(i));
+                text.push_back('\t');
+                append_number(text, y);
+                text.push_back('\t');
+                append_number(text, result[grid.get_interior_index(i, j)]);
+                text.push_back('\n');
+            }
+        }
+    });
 
     return;
 }
@@ -176,23 +333,52 @@ void output_to_file(const double& lower_bound, const double& upper_bound, const
 *
 *  \pre upper_bound > lower_bound
 *  \pre mesh_length > 0
-*  \pre push_back() is defined for Vector
-*  \pre exact_eqn returns a T value
+*  \pre exact_eqn is safe to call concurrently
 *  \post (see return)
 *  \relates Matrix_Solver
 */
 template <typename T>
 Vector<T> gen_exact_sol(const double lower_bound, const double upper_bound, const int mesh_length, long double (*exact_eqn)(long double, long double)) {
-    Vector<T> vec((mesh_length - 1) * (mesh_length - 1));
-    double delta = upper_bound / mesh_length;
-
-    /* The ZERO_LIMIT (defined in libraries.h) is used to differentiate between y's and x's that are very, 
-       very close to the boundary. Without it, the vector is not generated with the correct size */
-    for (double y = lower_bound + delta; y < (upper_bound - ZERO_LIMIT); y += delta) {
-        for (double x = lower_bound + delta; x < (upper_bound - ZERO_LIMIT); x += delta) {
-            vec.push_back(exact_eqn(x, y));
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    Vector<T> vec(grid.get_interior_count(), 0);
+    T* data = vec.get_ptr();
+
+    // Rows are sampled concurrently, each into its own slice of the preallocated vector
+    default_scheduler().parallel_for(grid.get_row_begin(), grid.get_row_end(), [&](int j) {
+        long double y = grid.get_coordinate(j);
+        for (int i = grid.get_row_begin(); i < grid.get_row_end(); i++) {
+            data[grid.get_interior_index(i, j)] = T(exact_eqn(grid.get_coordinate(i), y));
         }
-    }
+    });
 
     return vec;
-}
\ No newline at end of file
+}
+
+/*! Compute the discrete L2 norm of the difference between an approximation and the exact solution
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param result the approximated solution vector
+*  \param exact_solution the exact solution sampled on the same mesh points (see gen_exact_sol)
+*  \return sqrt(delta^2 * sum((result - exact_solution)^2))
+*
+*  \pre upper_bound > lower_bound
+*  \pre mesh_length > 0
+*  \pre result.get_size() == exact_solution.get_size()
+*  \post (see return)
+*  \throws domain_error thrown if the vectors are not the same size
+*  \relates Matrix_Solver
+*/
+template <typename T>
+T error_norm(const double lower_bound, const double upper_bound, const int mesh_length, const Vector<T>& result, const Vector<T>& exact_solution) {
+    if (result.get_size() != exact_solution.get_size()) { throw domain_error("Error: Approximate and exact solutions must be of same size."); }
+
+    T delta = T(Grid_2D(lower_bound, upper_bound, mesh_length).get_delta());
+    T sum = 0;
+    for (int i = 0; i < result.get_size(); i++) {
+        sum += (result[i] - exact_solution[i]) * (result[i] - exact_solution[i]);
+    }
+
+    return sqrt(delta * delta * sum);
+}
@@ -0,0 +1,196 @@
+/*! \file
+ *   Various vector generators for the cube mesh
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+/*! Determines which boundary function to be called for the cube mesh point with indices (i, j, k)
+*
+*  Faces are checked in the order left, lower, back, right, upper, front so that edge and
+*  corner points are evaluated by exactly one function.
+*
+*  \param i the x index of the point (0 to mesh_length)
+*  \param j the y index of the point (0 to mesh_length)
+*  \param k the z index of the point (0 to mesh_length)
+*  \param grid the mesh, whose per-axis index to coordinate mapping is used for x, y and z
+*  \param *upper a pointer to the upper (y = upper_bound) boundary function
+*  \param *lower a pointer to the lower (y = lower_bound) boundary function
+*  \param *right a pointer to the right (x = upper_bound) boundary function
+*  \param *left a pointer to the left (x = lower_bound) boundary function
+*  \param *front a pointer to the front (z = upper_bound) boundary function
+*  \param *back a pointer to the back (z = lower_bound) boundary function
+*  \return a value calculated from plugging x, y and z into the appropriate boundary function, or 0 if the point is interior
+* 
+*  \pre mesh_length > 1
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+inline double boundary_func_3d(const int i, const int j, const int k, const Grid_2D& grid, double (*upper)(double, double, double), double (*lower)(double, double, double), double (*right)(double, double, double), double (*left)(double, double, double), double (*front)(double, double, double), double (*back)(double, double, double)) {
+    int mesh_length = grid.get_mesh_length();
+    double x = grid.get_coordinate(i);
+    double y = grid.get_coordinate(j);
+    double z = grid.get_coordinate(k);
+    double result;
+
+    if (i == 0) result = left(x, y, z);
+    else if (j == 0) result = lower(x, y, z);
+    else if (k == 0) result = back(x, y, z);
+    else if (i == mesh_length) result = right(x, y, z);
+    else if (j == mesh_length) result = upper(x, y, z);
+    else if (k == mesh_length) result = front(x, y, z);
+    else result = 0;
+
+    return result;
+}
+
+/*! Generate the b vector to be used in Ax=b for the 7-point Laplacian on a cube
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param upper a pointer to the upper (y = upper_bound) boundary function
+*  \param lower a pointer to the lower (y = lower_bound) boundary function
+*  \param right a pointer to the right (x = upper_bound) boundary function
+*  \param left a pointer to the left (x = lower_bound) boundary function
+*  \param front a pointer to the front (z = upper_bound) boundary function
+*  \param back a pointer to the back (z = lower_bound) boundary function
+*  \return the generated b vector, ordered with x fastest, then y, then z
+* 
+*  \pre upper_bound > lower_bound
+*  \pre mesh_length > 1
+*  \pre the boundary functions are safe to call concurrently
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+template <typename T>
+Vector<T> gen_callback_vec_3d(const double lower_bound, const double upper_bound, const int mesh_length, double (*upper)(double, double, double), double (*lower)(double, double, double), double (*right)(double, double, double), double (*left)(double, double, double), double (*front)(double, double, double), double (*back)(double, double, double)) {
+    int n = mesh_length - 1;
+    Vector<T> vec(n * n * n, 0);
+    T* data = vec.get_ptr();
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+
+    // Planes of constant z are assembled concurrently into the preallocated vector
+    default_scheduler().parallel_for(1, mesh_length, [&](int k) {
+        T* plane = data + (k - 1) * n * n;
+
+        for (int j = 1; j < mesh_length; j++) {
+            for (int i = 1; i < mesh_length; i++) {
+                double sum = boundary_func_3d(i + 1, j, k, grid, upper, lower, right, left, front, back)
+                           + boundary_func_3d(i - 1, j, k, grid, upper, lower, right, left, front, back)
+                           + boundary_func_3d(i, j + 1, k, grid, upper, lower, right, left, front, back)
+                           + boundary_func_3d(i, j - 1, k, grid, upper, lower, right, left, front, back)
+                           + boundary_func_3d(i, j, k + 1, grid, upper, lower, right, left, front, back)
+                           + boundary_func_3d(i, j, k - 1, grid, upper, lower, right, left, front, back);
+                plane[(j - 1) * n + (i - 1)] = T(sum / 6);
+            }
+        }
+    });
+
+    return vec;
+}
+
+/*! Evaluate the exact solution at the interior points of the cube mesh
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param *exact_eqn a pointer to a function that returns the exact solution for the points we are approximating
+*  \return a solution Vector ordered like gen_callback_vec_3d
+*
+*  \pre upper_bound > lower_bound
+*  \pre mesh_length > 1
+*  \post (see return)
+*  \relates Matrix_Solver
+*/
+template <typename T>
+Vector<T> gen_exact_sol_3d(const double lower_bound, const double upper_bound, const int mesh_length, long double (*exact_eqn)(long double, long double, long double)) {
+    int n = mesh_length - 1;
+    Vector<T> vec(n * n * n, 0);
+    T* data = vec.get_ptr();
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+
+    for (int k = 1; k < mesh_length; k++) {
+        for (int j = 1; j < mesh_length; j++) {
+            for (int i = 1; i < mesh_length; i++) {
+                data[((k - 1) * n + (j - 1)) * n + (i - 1)] = T(exact_eqn(grid.get_coordinate(i), grid.get_coordinate(j), grid.get_coordinate(k)));
+            }
+        }
+    }
+
+    return vec;
+}
+
+/*! Compute the discrete L2 norm of the difference between an approximation and the exact solution on the cube mesh
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param result the approximated solution vector
+*  \param exact_solution the exact solution sampled on the same mesh points (see gen_exact_sol_3d)
+*  \return sqrt(delta^3 * sum((result - exact_solution)^2))
+*
+*  \pre upper_bound > lower_bound
+*  \pre result.get_size() == exact_solution.get_size()
+*  \post (see return)
+*  \throws domain_error thrown if the vectors are not the same size
+*  \relates Matrix_Solver
+*/
+template <typename T>
+T error_norm_3d(const double lower_bound, const double upper_bound, const int mesh_length, const Vector<T>& result, const Vector<T>& exact_solution) {
+    T delta = T((upper_bound - lower_bound) / mesh_length);
+
+    return error_norm(lower_bound, upper_bound, mesh_length, result, exact_solution) * sqrt(delta);
+}
+
+/*! Write the x, y, z and u values of a cube mesh solution to a file, to be used with graphing
+*
+*  Blocks of mesh rows are formatted concurrently and written in order (see write_chunked_text), so
+*  the file is the same as formatting it line by line.
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param result a Vector representing the solution vector x in Ax=b
+*  \param file_name the name of the file to be written to
+* 
+*  \pre upper_bound > lower_bound
+*  \pre mesh_length > 1
+*  \pre result.get_size() == (mesh_length - 1)^3
+*  \post the x, y, z and u values of our solution are written to a file
+*  \throws domain_error thrown if result is not sized for the mesh
+*  \throws runtime_error thrown if the file cannot be written
+*  \relates Matrix_Solver
+*/
+template <typename T>
+void output_to_file_3d(const double& lower_bound, const double& upper_bound, const int& mesh_length, const Vector<T>& result, const string& file_name) {
+    int n = mesh_length - 1;
+    if (n < 1 || result.get_size() != n * n * n) { throw domain_error("Error: Vector must have one entry per interior mesh point."); }
+
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    const T* data = result.get_ptr();
+
+    // Blocks of whole mesh rows (fixed j and k) are formatted concurrently and written in order
+    int rows_per_chunk = max(1, TEXT_CHUNK_LINES / n);
+    int chunk_count = (n * n + rows_per_chunk - 1) / rows_per_chunk;
+
+    write_chunked_text(file_name, chunk_count, [&](int chunk, string& text) {
+        int first = chunk * rows_per_chunk;
+        int last = min(n * n, first + rows_per_chunk);
+        for (int row = first; row < last; row++) {
+            int j = row % n + 1;
+            int k = row / n + 1;
+            for (int i = 1; i < mesh_length; i++) {
+                append_number(text, grid.get_coordinate(i));
+                text.push_back('\t');
+                append_number(text, grid.get_coordinate(j));
+                text.push_back('\t');
+                append_number(text, grid.get_coordinate(k));
+                text.push_back('\t');
+                append_number(text, data[row * n + (i - 1)]);
+                text.push_back('\n');
+            }
+        }
+    });
+
+    return;
+}
@@ -0,0 +1,93 @@
+/*! \file
+ *  Grid_2D class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef GRID_2D_H
+#define GRID_2D_H
+#include "libraries.h"
+
+/*! Square finite difference mesh on [lower_bound, upper_bound]^2 with mesh_length steps per side
+ *
+ *  Mesh lines are addressed by integer index 0 to mesh_length and mapped to coordinates as
+ *  lower_bound + k * delta, so no rounding accumulates along a row. The interior points
+ *  (indices 1 to mesh_length - 1 in both directions) are numbered x fastest, which is the
+ *  ordering of the unknowns in the b vector and the solution. The cube meshes of the 3D generators
+ *  use the same per-axis mapping (`get_coordinate`).
+ *
+ *  Interior rows are independent, so passes over the mesh run as
+ *  `parallel_for(grid.get_row_begin(), grid.get_row_end(), ...)` writing into preallocated vectors.
+ */
+class Grid_2D {
+    private:
+        double m_lower_bound;
+        double m_upper_bound;
+        int m_mesh_length;
+        double m_delta;
+
+    public:
+        /*! Constructor
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param mesh_length the mesh length (number of steps per side)
+          *
+          * \pre upper_bound > lower_bound
+          * \pre mesh_length > 0
+          * \post the grid is constructed
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        Grid_2D(const double& lower_bound, const double& upper_bound, const int& mesh_length);
+
+        /*! Returns the lower bound of the mesh */
+        double get_lower_bound() const { return m_lower_bound; }
+
+        /*! Returns the upper bound of the mesh */
+        double get_upper_bound() const { return m_upper_bound; }
+
+        /*! Returns the mesh length */
+        int get_mesh_length() const { return m_mesh_length; }
+
+        /*! Returns the mesh spacing (upper_bound - lower_bound) / mesh_length */
+        double get_delta() const { return m_delta; }
+
+        /*! Returns the number of interior points per row (mesh_length - 1) */
+        int get_row_length() const { return m_mesh_length - 1; }
+
+        /*! Returns the number of interior points ((mesh_length - 1)^2), the size of b and the solution */
+        int get_interior_count() const { return (m_mesh_length - 1) * (m_mesh_length - 1); }
+
+        /*! Returns the number of points per side including the boundary (mesh_length + 1) */
+        int get_padded_length() const { return m_mesh_length + 1; }
+
+        /*! Returns the first interior row/column index (1) */
+        int get_row_begin() const { return 1; }
+
+        /*! Returns one past the last interior row/column index (mesh_length) */
+        int get_row_end() const { return m_mesh_length; }
+
+        /*! Maps a mesh line index to its coordinate
+          *
+          * \param k the index of the mesh line (0 to mesh_length)
+          * \return lower_bound + k * delta, with the last line pinned to upper_bound
+          *
+          * \pre 0 <= k <= mesh_length
+          * \post (see return)
+        */
+        double get_coordinate(const int& k) const;
+
+        /*! Maps an interior point to its position in b and the solution
+          *
+          * \param i the x index of the point (1 to mesh_length - 1)
+          * \param j the y index of the point (1 to mesh_length - 1)
+          * \return (j - 1) * (mesh_length - 1) + (i - 1)
+          *
+          * \pre 1 <= i, j <= mesh_length - 1
+          * \post (see return)
+        */
+        int get_interior_index(const int& i, const int& j) const { return (j - 1) * (m_mesh_length - 1) + (i - 1); }
+};
+
+#include "grid_2d.hpp"
+#endif
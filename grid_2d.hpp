@@ -0,0 +1,17 @@
+/*! \file
+ *  Function definitions for the `Grid_2D` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline Grid_2D::Grid_2D(const double& lower_bound, const double& upper_bound, const int& mesh_length)
+    : m_lower_bound(lower_bound), m_upper_bound(upper_bound), m_mesh_length(mesh_length), m_delta(0) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+    if (mesh_length <= 0) { throw domain_error("Error: Mesh length should be greater than 0."); }
+
+    m_delta = (upper_bound - lower_bound) / mesh_length;
+}
+
+inline double Grid_2D::get_coordinate(const int& k) const {
+    return (k == m_mesh_length) ? m_upper_bound : m_lower_bound + k * m_delta;
+}
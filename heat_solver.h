@@ -0,0 +1,108 @@
+/*! \file
+ *  Heat_Solver class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef HEAT_SOLVER_H
+#define HEAT_SOLVER_H
+#include "matrix_solver.h"
+
+/*! Time integration scheme for the heat equation (theta = 1 and theta = 1/2 respectively) */
+enum Time_Scheme { backward_euler, crank_nicolson };
+
+/*! Heat equation (u_t = laplacian(u)) solver on the square mesh
+ *
+ *  The theta scheme (I + theta * r * A) u^(n+1) = (I - (1 - theta) * r * A) u^n + r * b is used,
+ *  where A and b are the 5-point coefficient matrix and boundary vector of the steady problem
+ *  and r = 4 * time_step / delta^2. The left hand matrix does not change between steps, so it
+ *  is factored once and every step only performs the triangular solves.
+ */
+template <class T>
+class Heat_Solver {
+    private:
+        int m_mesh_length;
+        double m_time_step;
+        double m_theta;
+        T m_ratio;
+
+        // Current state of the integration
+        int m_step;
+        double m_time;
+        Vector<T> m_solution;
+
+        // Boundary contribution and the constant left hand side (m_matrix must precede m_solver)
+        Vector<T> m_boundary;
+        Symmetric_Matrix<T> m_matrix;
+        Matrix_Solver<T> m_solver;
+
+        // Stencil applying A for the explicit part, and its padded input and output (zero ghost rings)
+        Stencil_Operator_2D<T> m_operator;
+        Vector<T> m_padded;
+        Vector<T> m_product;
+
+        /*! Checks the constructor arguments before any member is built from them
+          *
+          * \return mesh_length
+          * \throws domain_error thrown if the bounds, mesh length or time step are invalid
+        */
+        static int checked_mesh_length(const double& lower_bound, const double& upper_bound, const int& mesh_length, const double& time_step);
+
+    public:
+        /*! Constructs the solver and factors the time stepping matrix
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param mesh_length the mesh length
+          * \param time_step the time step (delta t)
+          * \param scheme the time integration scheme
+          * \param initial a pointer to the initial condition u(x, y, 0)
+          * \param upper a pointer to the upper boundary function
+          * \param lower a pointer to the lower boundary function
+          * \param right a pointer to the right boundary function
+          * \param left a pointer to the left boundary function
+          * 
+          * \pre upper_bound > lower_bound
+          * \pre mesh_length > 1
+          * \pre time_step > 0
+          * \pre initial is safe to call concurrently (it is sampled row by row on the default scheduler)
+          * \post the time stepping matrix is assembled and factored, time is 0
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        Heat_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const double& time_step, const Time_Scheme& scheme, double (*initial)(double, double), double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double));
+
+        /*! Advances the solution by one time step
+          * 
+          * \return the solution at the new time
+          * 
+          * \pre none
+          * \post the solution, step count and time are advanced (only substitutions are performed)
+        */
+        const Vector<T>& step();
+
+        /*! Advances the solution by `num_steps` time steps
+          * 
+          * \param num_steps the number of steps to take
+          * \param snapshot optional function called with (step, time, solution) after every `snapshot_interval` steps
+          * \param snapshot_interval how many steps to take between snapshots
+          * \return the solution at the final time
+          * 
+          * \pre num_steps >= 0
+          * \pre snapshot_interval > 0
+          * \post (see return)
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        const Vector<T>& run(const int& num_steps, void (*snapshot)(const int&, const double&, const Vector<T>&) = nullptr, const int& snapshot_interval = 1);
+
+        /*! Getter for the current solution */
+        const Vector<T>& get_solution() const { return m_solution; }
+
+        /*! Getter for the current time */
+        double get_time() const { return m_time; }
+
+        /*! Getter for the number of steps taken */
+        int get_step() const { return m_step; }
+};
+
+#include "heat_solver.hpp"
+#endif
@@ -0,0 +1,100 @@
+/*! \file
+ *  Function definitions for the `Heat_Solver` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+/*! Assemble the left hand matrix I + theta * ratio * A of the theta scheme
+*
+*  \param mesh_length the length of the mesh
+*  \param scale the value theta * ratio
+*  \return the time stepping matrix
+*
+*  \pre mesh_length > 1
+*  \post (see return)
+*  \relates Heat_Solver
+*/
+template <typename T>
+Symmetric_Matrix<T> gen_time_step_matrix(const int& mesh_length, const T& scale) {
+    Symmetric_Matrix<T> a = gen_coefficient_matrix<T>(mesh_length) * scale;
+
+    for (int i = 0; i < a.get_size(); i++) {
+        a.set_element(i, i, a.get_element(i, i) + 1);
+    }
+
+    return a;
+}
+
+template <typename T>
+int Heat_Solver<T>::checked_mesh_length(const double& lower_bound, const double& upper_bound, const int& mesh_length, const double& time_step) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+    if (time_step <= 0) { throw domain_error("Error: Time step should be greater than 0."); }
+
+    return mesh_length;
+}
+
+template <typename T>
+Heat_Solver<T>::Heat_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const double& time_step, const Time_Scheme& scheme, double (*initial)(double, double), double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double))
+    : m_mesh_length(checked_mesh_length(lower_bound, upper_bound, mesh_length, time_step)), m_time_step(time_step), m_theta(scheme == crank_nicolson ? 0.5 : 1.0),
+      m_ratio(T(4 * time_step / (((upper_bound - lower_bound) / mesh_length) * ((upper_bound - lower_bound) / mesh_length)))),
+      m_step(0), m_time(0), m_solution((mesh_length - 1) * (mesh_length - 1), 0),
+      m_boundary(gen_callback_vec<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left)),
+      m_matrix(gen_time_step_matrix<T>(mesh_length, T(m_theta) * m_ratio)),
+      m_solver(m_matrix, m_boundary), m_operator(mesh_length),
+      m_padded(m_operator.get_padded_size(), 0), m_product(m_operator.get_padded_size(), 0) {
+    // Sample the initial condition on the interior mesh points
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    T* data = m_solution.get_ptr();
+    default_scheduler().parallel_for(grid.get_row_begin(), grid.get_row_end(), [&](int j) {
+        double y = grid.get_coordinate(j);
+        for (int i = grid.get_row_begin(); i < grid.get_row_end(); i++) {
+            data[grid.get_interior_index(i, j)] = T(initial(grid.get_coordinate(i), y));
+        }
+    });
+
+    // Scale the boundary contribution once; it is the same for every step
+    m_boundary = m_boundary * m_ratio;
+
+    m_solver.factorize();
+}
+
+template <typename T>
+const Vector<T>& Heat_Solver<T>::step() {
+    // Explicit part of the theta scheme (vanishes for backward Euler): rhs -= (1 - theta) * r * A u,
+    // with A applied in place on the padded buffers
+    Vector<T> rhs(m_solution);
+    if (m_theta != 1.0) {
+        const int n = m_mesh_length - 1;
+        const int stride = m_mesh_length + 1;
+        const T* solution = m_solution.get_ptr();
+        for (int j = 0; j < n; j++) { std::copy(solution + j * n, solution + (j + 1) * n, m_padded.get_ptr() + (j + 1) * stride + 1); }
+
+        m_operator.apply_padded(m_padded.get_ptr(), m_product.get_ptr());
+        const T scale = -(T(1 - m_theta) * m_ratio);
+        for (int j = 0; j < n; j++) { vector_axpy(scale, m_product.get_ptr() + (j + 1) * stride + 1, rhs.get_ptr() + j * n, n); }
+    }
+    rhs += m_boundary;
+
+    m_solution = m_solver.solve(rhs);
+    m_step++;
+    m_time = m_step * m_time_step;
+
+    return m_solution;
+}
+
+template <typename T>
+const Vector<T>& Heat_Solver<T>::run(const int& num_steps, void (*snapshot)(const int&, const double&, const Vector<T>&), const int& snapshot_interval) {
+    if (num_steps < 0) { throw domain_error("Error: Number of time steps should not be negative."); }
+    if (snapshot_interval <= 0) { throw domain_error("Error: Snapshot interval should be greater than 0."); }
+
+    for (int i = 0; i < num_steps; i++) {
+        step();
+
+        if (snapshot != nullptr && m_step % snapshot_interval == 0) {
+            snapshot(m_step, m_time, m_solution);
+        }
+    }
+
+    return m_solution;
+}
@@ -0,0 +1,134 @@
+/*! \file
+ *  Iterative_Batch class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef ITERATIVE_BATCH_H
+#define ITERATIVE_BATCH_H
+#include "linear_operator.h"
+#include <deque>
+#include <exception>
+#include <vector>
+
+/*! Default number of solves advanced together per operator */
+const int BATCH_LANES = 8;
+
+/*! Interleaves many small conjugate gradient solves on the calling thread.
+ *
+ *  Every queued solve is a resumable state (a stand-in for a coroutine) that yields after
+ *  each iteration. Solves sharing an operator are packed into the lanes of a block, stored
+ *  interleaved (element i of lane l at i * lanes + l), so one pass over the operator applies
+ *  it to every lane and one pass over the block forms every lane's dot products. When a lane
+ *  converges its slot is refilled with the next queued solve of the same operator, and the
+ *  blocks of different operators take turns one iteration at a time.
+ */
+template <class T>
+class Iterative_Batch {
+    private:
+        /*! A queued solve and, once finished, its outcome */
+        struct Request {
+            const Linear_Operator<T>* op;
+            Vector<T> rhs;
+            Vector<T> result;
+            int iterations;
+            T residual;
+            bool done;
+            std::exception_ptr error;
+        };
+
+        /*! The lanes of the solves sharing one operator */
+        struct Lane_Block {
+            const Linear_Operator<T>* op;
+            int size;
+            Vector<T> x;
+            Vector<T> r;
+            Vector<T> p;
+            Vector<T> image;
+            Vector<int> tickets;
+            Vector<T> residual_squared;
+            Vector<T> rhs_norm;
+            Vector<int> iterations;
+            std::deque<int> pending;
+        };
+
+        T m_tolerance;
+        int m_max_iterations;
+        int m_lanes;
+        std::vector<Request> m_requests;
+        std::vector<Lane_Block> m_blocks;
+
+        /*! Puts the next pending solve of `block` into `lane` (or leaves the lane empty) */
+        void load_lane(Lane_Block& block, const int& lane);
+
+        /*! Records the outcome of the solve in `lane` and refills the lane */
+        void retire_lane(Lane_Block& block, const int& lane, const std::exception_ptr& error);
+
+        /*! Advances every occupied lane of `block` by one iteration */
+        void step_block(Lane_Block& block);
+
+    public:
+        /*! Constructs an empty batch
+          *
+          * \param tolerance the relative residual (|r| / |b|) to stop iterating at
+          * \param max_iterations the maximum number of iterations of each solve
+          * \param lanes the number of solves advanced together per operator
+          * 
+          * \pre tolerance > 0, max_iterations > 0, lanes > 0
+          * \post the tolerance is raised to a few machine epsilons of T if it is tighter than T can resolve
+          * \throws domain_error thrown if pre-condition broken
+        */
+        Iterative_Batch(const double& tolerance = ITERATIVE_TOLERANCE, const int& max_iterations = MAX_ITERATIONS, const int& lanes = BATCH_LANES);
+
+        /*! Queues the solve of op * x = rhs
+          *
+          * \param op the symmetric positive definite operator (solves passing the same object share lanes)
+          * \param rhs the right hand side
+          * \return the ticket of the solve
+          * 
+          * \pre `op` outlives the batch
+          * \pre op.get_size() == rhs.get_size()
+          * \post the solve is queued
+          * \throws domain_error thrown if the sizes differ
+        */
+        int add(const Linear_Operator<T>& op, const Vector<T>& rhs);
+
+        /*! Runs one iteration of every block (one yield of every running solve)
+          *
+          * \return true if solves remain unfinished
+          * 
+          * \pre none
+          * \post solves that converged or failed during the iteration are finished
+        */
+        bool step();
+
+        /*! Runs every queued solve to completion
+          *
+          * \pre none
+          * \post every solve is finished
+        */
+        void run();
+
+        /*! Gets the solution of a finished solve
+          *
+          * \pre `ticket` was returned by add and the solve is finished
+          * \post (see return)
+          * \throws out_of_range thrown if the ticket is unknown
+          * \throws domain_error thrown if the solve is not finished
+          * \throws rethrows the error of the solve (domain_error if the operator is not positive definite,
+          *         runtime_error if it did not converge)
+        */
+        const Vector<T>& get_result(const int& ticket) const;
+
+        /*! Gets the number of iterations a finished solve took */
+        int get_iterations(const int& ticket) const { return m_requests.at(ticket).iterations; }
+
+        /*! Gets the final relative residual of a finished solve */
+        T get_residual(const int& ticket) const { return m_requests.at(ticket).residual; }
+
+        /*! Gets the number of solves added */
+        int get_size() const { return static_cast<int>(m_requests.size()); }
+};
+
+#include "iterative_batch.hpp"
+#endif
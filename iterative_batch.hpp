@@ -0,0 +1,203 @@
+/*! \file
+ *  Function definitions for the `Iterative_Batch` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Iterative_Batch<T>::Iterative_Batch(const double& tolerance, const int& max_iterations, const int& lanes)
+    : m_tolerance(max(T(tolerance), T(10) * numeric_limits<T>::epsilon())), m_max_iterations(max_iterations), m_lanes(lanes) {
+    if (tolerance <= 0) { throw domain_error("Error: Iterative tolerance should be greater than 0."); }
+    if (max_iterations <= 0) { throw domain_error("Error: Maximum number of iterations should be greater than 0."); }
+    if (lanes <= 0) { throw domain_error("Error: Number of lanes should be greater than 0."); }
+}
+
+template <typename T>
+int Iterative_Batch<T>::add(const Linear_Operator<T>& op, const Vector<T>& rhs) {
+    if (op.get_size() != rhs.get_size()) { throw domain_error("Error: Conjugate gradient requires an operator of same size as the vector."); }
+
+    Request request = { &op, rhs, Vector<T>(), 0, T(0), false, std::exception_ptr() };
+    m_requests.push_back(request);
+    int ticket = get_size() - 1;
+
+    size_t b = 0;
+    while (b < m_blocks.size() && m_blocks[b].op != &op) { b++; }
+    if (b == m_blocks.size()) {
+        int n = op.get_size() * m_lanes;
+        Lane_Block block = { &op, op.get_size(), Vector<T>(n, 0), Vector<T>(n, 0), Vector<T>(n, 0), Vector<T>(n, 0),
+                             Vector<int>(m_lanes, -1), Vector<T>(m_lanes, 0), Vector<T>(m_lanes, 0), Vector<int>(m_lanes, 0), std::deque<int>() };
+        m_blocks.push_back(block);
+    }
+    m_blocks[b].pending.push_back(ticket);
+
+    return ticket;
+}
+
+template <typename T>
+void Iterative_Batch<T>::load_lane(Lane_Block& block, const int& lane) {
+    int lanes = m_lanes;
+    T* x = block.x.get_ptr();
+    T* r = block.r.get_ptr();
+    T* p = block.p.get_ptr();
+
+    while (!block.pending.empty()) {
+        int ticket = block.pending.front();
+        block.pending.pop_front();
+        const Vector<T>& rhs = m_requests[ticket].rhs;
+
+        T rhs_squared = rhs * rhs;
+        if (rhs_squared == 0) {
+            m_requests[ticket].result = Vector<T>(block.size, 0);
+            m_requests[ticket].done = true;
+            continue;
+        }
+
+        // Start from x = 0 so the residual and the first direction are the right hand side
+        for (int i = 0; i < block.size; i++) {
+            x[i * lanes + lane] = 0;
+            r[i * lanes + lane] = rhs[i];
+            p[i * lanes + lane] = rhs[i];
+        }
+        block.tickets[lane] = ticket;
+        block.residual_squared[lane] = rhs_squared;
+        block.rhs_norm[lane] = sqrt(rhs_squared);
+        block.iterations[lane] = 0;
+        return;
+    }
+
+    // Nothing left to run: an empty lane has no residual and no direction, so it stays at zero
+    for (int i = 0; i < block.size; i++) {
+        r[i * lanes + lane] = 0;
+        p[i * lanes + lane] = 0;
+    }
+    block.tickets[lane] = -1;
+    block.residual_squared[lane] = 0;
+
+    return;
+}
+
+template <typename T>
+void Iterative_Batch<T>::retire_lane(Lane_Block& block, const int& lane, const std::exception_ptr& error) {
+    Request& request = m_requests[block.tickets[lane]];
+    const T* x = block.x.get_ptr();
+
+    request.result = Vector<T>(block.size, 0);
+    for (int i = 0; i < block.size; i++) {
+        request.result[i] = x[i * m_lanes + lane];
+    }
+    request.iterations = block.iterations[lane];
+    request.residual = sqrt(block.residual_squared[lane]) / block.rhs_norm[lane];
+    request.error = error;
+    request.done = true;
+
+    load_lane(block, lane);
+
+    return;
+}
+
+template <typename T>
+void Iterative_Batch<T>::step_block(Lane_Block& block) {
+    int lanes = m_lanes;
+    int n = block.size;
+    T* x = block.x.get_ptr();
+    T* r = block.r.get_ptr();
+    T* p = block.p.get_ptr();
+    T* image = block.image.get_ptr();
+
+    // One matvec for every lane
+    block.op->apply_interleaved(p, image, lanes);
+
+    // Every lane's curvature in one pass
+    Vector<T> alpha(lanes, 0);
+    T* step = alpha.get_ptr();
+    for (int i = 0; i < n; i++) {
+        for (int l = 0; l < lanes; l++) { step[l] += p[i * lanes + l] * image[i * lanes + l]; }
+    }
+    for (int l = 0; l < lanes; l++) {
+        if (block.tickets[l] < 0) { step[l] = 0; }
+        else if (step[l] <= 0) {
+            step[l] = 0;
+            retire_lane(block, l, std::make_exception_ptr(domain_error("Error: Conjugate gradient requires a positive definite operator.")));
+        }
+        else { step[l] = block.residual_squared[l] / step[l]; }
+    }
+
+    // Update the iterates and form every lane's new residual norm in one pass
+    Vector<T> next_residual_squared(lanes, 0);
+    T* next = next_residual_squared.get_ptr();
+    for (int i = 0; i < n; i++) {
+        for (int l = 0; l < lanes; l++) {
+            x[i * lanes + l] += step[l] * p[i * lanes + l];
+            r[i * lanes + l] -= step[l] * image[i * lanes + l];
+            next[l] += r[i * lanes + l] * r[i * lanes + l];
+        }
+    }
+
+    Vector<T> beta(lanes, 0);
+    for (int l = 0; l < lanes; l++) {
+        if (block.tickets[l] < 0 || step[l] == 0) { continue; }
+        beta[l] = next[l] / block.residual_squared[l];
+        block.residual_squared[l] = next[l];
+        block.iterations[l]++;
+    }
+
+    const T* scale = beta.get_ptr();
+    for (int i = 0; i < n; i++) {
+        for (int l = 0; l < lanes; l++) { p[i * lanes + l] = r[i * lanes + l] + scale[l] * p[i * lanes + l]; }
+    }
+
+    // Finished lanes hand their slot to the next queued solve
+    for (int l = 0; l < lanes; l++) {
+        if (block.tickets[l] < 0 || step[l] == 0) { continue; }
+        if (sqrt(block.residual_squared[l]) <= m_tolerance * block.rhs_norm[l]) {
+            retire_lane(block, l, std::exception_ptr());
+        }
+        else if (block.iterations[l] == m_max_iterations) {
+            retire_lane(block, l, std::make_exception_ptr(runtime_error("Error: Conjugate gradient did not converge within the maximum number of iterations.")));
+        }
+    }
+
+    return;
+}
+
+template <typename T>
+bool Iterative_Batch<T>::step() {
+    bool remaining = false;
+
+    for (size_t b = 0; b < m_blocks.size(); b++) {
+        Lane_Block& block = m_blocks[b];
+        for (int l = 0; l < m_lanes; l++) {
+            if (block.tickets[l] < 0 && !block.pending.empty()) { load_lane(block, l); }
+        }
+
+        bool occupied = false;
+        for (int l = 0; l < m_lanes; l++) {
+            if (block.tickets[l] >= 0) { occupied = true; }
+        }
+        if (!occupied) { continue; }
+
+        step_block(block);
+        for (int l = 0; l < m_lanes; l++) {
+            if (block.tickets[l] >= 0) { remaining = true; }
+        }
+        if (!block.pending.empty()) { remaining = true; }
+    }
+
+    return remaining;
+}
+
+template <typename T>
+void Iterative_Batch<T>::run() {
+    while (step()) {}
+
+    return;
+}
+
+template <typename T>
+const Vector<T>& Iterative_Batch<T>::get_result(const int& ticket) const {
+    const Request& request = m_requests.at(ticket);
+    if (!request.done) { throw domain_error("Error: Solve has not finished."); }
+    if (request.error) { std::rethrow_exception(request.error); }
+
+    return request.result;
+}
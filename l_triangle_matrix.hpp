@@ -31,7 +31,11 @@ L_Triangle_Matrix<T>::L_Triangle_Matrix(const Base_Matrix<T>& source) : General_
 } 
 
 template <typename T>
-L_Triangle_Matrix<T>::L_Triangle_Matrix(L_Triangle_Matrix<T>&& other) : General_Matrix<T>(other), m_state(other.m_state) {}
+L_Triangle_Matrix<T>::L_Triangle_Matrix(L_Triangle_Matrix<T>&& other) : General_Matrix<T>(other.m_size), m_state(other.m_state) {
+    std::swap(this->m_elements, other.m_elements);
+    this->m_size = other.m_size;
+    other.m_size = 0;
+}
 
 template <typename T>
 L_Triangle_Matrix<T>& L_Triangle_Matrix<T>::operator=(const L_Triangle_Matrix<T>& source) {
@@ -189,6 +193,24 @@ Vector<T> L_Triangle_Matrix<T>::back_sub(const Vector<Vector<T> >& matrix_data,
     return result;
 }
 
+template <typename T>
+template <int lanes>
+void L_Triangle_Matrix<T>::back_sub_interleaved(T* block) const {
+    for (int row = 0; row < this->m_size; row++) {
+        const T* l_row = this->m_elements[row].get_ptr();
+        if (l_row[row] == 0) { throw domain_error("Error: Division by zero during back substitution."); }
+
+        T sum[lanes];
+        for (int l = 0; l < lanes; l++) { sum[l] = block[row * lanes + l]; }
+
+        vector_interleaved_update<lanes>(l_row, row, block, sum);
+
+        for (int l = 0; l < lanes; l++) { block[row * lanes + l] = sum[l] / l_row[row]; }
+    }
+
+    return;
+}
+
 template <typename T>
 istream& operator>>(istream& in, L_Triangle_Matrix<T>& matrix_in) {
     for (int i = 0; i < matrix_in.get_max(); i++) {
@@ -13,6 +13,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
@@ -31,4 +32,12 @@ const int PRECISION = 8;
 */
 const double ZERO_LIMIT = 0.000000001;
 
+/*! The relative residual tolerance for iterative solvers
+*/
+const double ITERATIVE_TOLERANCE = 0.0000000001;
+
+/*! The maximum number of iterations for iterative solvers
+*/
+const int MAX_ITERATIONS = 10000;
+
 #endif
\ No newline at end of file
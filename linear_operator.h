@@ -0,0 +1,91 @@
+/*! \file
+ *  Linear_Operator and Matrix_Operator class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef LINEAR_OPERATOR_H
+#define LINEAR_OPERATOR_H
+#include "base_matrix.h"
+
+/*! Abstract operator that can only be applied to a vector. Used by iterative strategies so that
+ *  the coefficient matrix never has to be stored (matrix-free).
+ */
+template <class T>
+class Linear_Operator {
+    public:
+        /*! Applies the operator to `vec` */
+        virtual Vector<T> operator*(const Vector<T>& vec) const = 0;
+
+        /*! Gets the number of rows (and columns) of the operator */
+        virtual int get_size() const = 0;
+
+        /*! Applies the operator to `lanes` vectors stored interleaved (element i of vector l at i * lanes + l)
+          *
+          * \param in the interleaved input vectors
+          * \param out the interleaved products (must not alias `in`)
+          * \param lanes the number of vectors
+          * 
+          * \pre `in` and `out` hold get_size() * lanes elements
+          * \post out holds the product of the operator with every lane of `in`
+        */
+        virtual void apply_interleaved(const T* in, T* out, const int& lanes) const {
+            int size = get_size();
+            Vector<T> lane(size, 0);
+            for (int l = 0; l < lanes; l++) {
+                for (int i = 0; i < size; i++) { lane[i] = in[i * lanes + l]; }
+                Vector<T> product = (*this) * lane;
+                for (int i = 0; i < size; i++) { out[i * lanes + l] = product[i]; }
+            }
+        }
+
+        /*! Gets the estimated floating point operations of one product (a dense product by default) */
+        virtual double get_apply_flops() const { return 2.0 * double(get_size()) * double(get_size()); }
+
+        /*! Virtual destructor */
+        virtual ~Linear_Operator() {}
+};
+
+/*! Adapter presenting a stored matrix as a `Linear_Operator` */
+template <class T>
+class Matrix_Operator : public Linear_Operator<T> {
+    private:
+        const Base_Matrix<T>& m_matrix;
+
+    public:
+        /*! Constructs the adapter
+          *
+          * \param matrix the matrix to apply
+          * 
+          * \pre `matrix` outlives the adapter (it is referenced, not copied)
+          * \post none
+        */
+        Matrix_Operator(const Base_Matrix<T>& matrix) : m_matrix(matrix) {}
+
+        /*! Multiplies the matrix with `vec` element by element (O(n^2))
+          *
+          * \pre vec.get_size() == get_size()
+          * \post none
+          * \return matrix * vec
+          * \throws domain_error thrown if the sizes differ
+        */
+        virtual Vector<T> operator*(const Vector<T>& vec) const {
+            if (m_matrix.get_size() != vec.get_size()) { throw domain_error("Error: Square matrix to be multiplied by vector must have same number of rows"); }
+
+            Vector<T> result(vec);
+            for (int row = 0; row < m_matrix.get_size(); row++) {
+                T sum(0);
+                for (int col = 0; col < m_matrix.get_size(); col++) {
+                    sum += m_matrix.get_element(row, col) * vec[col];
+                }
+                result[row] = sum;
+            }
+
+            return result;
+        }
+
+        /*! Gets the size of the underlying matrix */
+        virtual int get_size() const { return m_matrix.get_size(); }
+};
+
+#endif
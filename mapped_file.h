@@ -0,0 +1,51 @@
+/*! \file
+ *  Mapped_File class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+#include "libraries.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*! Read-only memory mapping of a whole file
+ *
+ *  The pages are read in by the kernel as they are touched, with no copy into a stream buffer.
+ *  An empty file has no mapping (get_data is nullptr and get_size 0).
+ */
+class Mapped_File {
+    private:
+        void* m_data;
+        size_t m_size;
+
+        // A mapping is unmapped exactly once
+        Mapped_File(const Mapped_File&);
+        Mapped_File& operator=(const Mapped_File&);
+
+    public:
+        /*! Maps `file_name`
+          *
+          * \param file_name the file to map
+          * \param sequential hint that the file is read front to back (enables read-ahead)
+          *
+          * \post the file is mapped read-only
+          * \throws runtime_error thrown if the file cannot be opened or mapped
+        */
+        explicit Mapped_File(const string& file_name, const bool& sequential = true);
+
+        /*! Unmaps the file */
+        ~Mapped_File();
+
+        /*! Gets the first byte of the file */
+        const char* get_data() const { return static_cast<const char*>(m_data); }
+
+        /*! Gets the size of the file in bytes */
+        size_t get_size() const { return m_size; }
+};
+
+#include "mapped_file.hpp"
+#endif
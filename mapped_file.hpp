@@ -0,0 +1,32 @@
+/*! \file
+ *  Function definitions for the `Mapped_File` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline Mapped_File::Mapped_File(const string& file_name, const bool& sequential) : m_data(nullptr), m_size(0) {
+    int file = open(file_name.c_str(), O_RDONLY);
+    if (file < 0) { throw runtime_error("Error: Could not open " + file_name + "."); }
+
+    struct stat info;
+    if (fstat(file, &info) != 0) {
+        close(file);
+        throw runtime_error("Error: Could not read " + file_name + ".");
+    }
+
+    m_size = size_t(info.st_size);
+    if (m_size > 0) {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED) {
+            close(file);
+            throw runtime_error("Error: Could not map " + file_name + ".");
+        }
+        m_data = data;
+        if (sequential) { madvise(m_data, m_size, MADV_SEQUENTIAL); }
+    }
+    close(file);
+}
+
+inline Mapped_File::~Mapped_File() {
+    if (m_data != nullptr) { munmap(m_data, m_size); }
+}
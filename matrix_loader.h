@@ -0,0 +1,84 @@
+/*! \file
+ *  Bulk loaders that read vectors and matrices from memory-mapped text files.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef MATRIX_LOADER_H
+#define MATRIX_LOADER_H
+#include "libraries.h"
+#include "vector.h"
+#include "general_matrix.h"
+#include "symmetric_matrix.h"
+#include "mapped_file.h"
+#include "task_scheduler.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+/*! Longest number (in characters) the loaders accept */
+const int MAX_NUMBER_LENGTH = 63;
+
+/*! Powers of ten exactly representable in a long double (10^27 = 2^27 * 5^27 and 5^27 < 2^64) */
+const long double POWERS_OF_TEN[] = { 1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+                                      1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L };
+
+/*! Bytes of a file scanned by a single task when counting the numbers in it */
+const size_t LOADER_CHUNK_BYTES = size_t(1) << 20;
+
+/*! How the rows of a matrix are laid out in a text file */
+enum Matrix_Layout {
+    full_layout,    //!< every row holds all n entries
+    lower_layout    //!< row i holds only the i + 1 entries up to the diagonal (packed lower triangle)
+};
+
+/*! Reads a vector from a text file
+ *
+ *  \param file_name the file holding the entries separated by any whitespace
+ *  \pre T is float, double or long double
+ *  \return a vector with one entry per number in the file
+ *  \throws runtime_error thrown if the file cannot be read or holds something that is not a number
+ */
+template <typename T>
+Vector<T> load_vector(const string& file_name);
+
+/*! Reads a square matrix from a text file
+ *
+ *  The size is taken from the file. With one row per line, a file whose first line holds one
+ *  number is a packed lower triangle (its upper triangle is zero); otherwise each line holds a
+ *  full row. A file not laid out by line must hold n * n numbers.
+ *
+ *  \param file_name the file holding the matrix
+ *  \pre T is float, double or long double
+ *  \return the matrix
+ *  \throws runtime_error thrown if the file cannot be read or does not hold a square matrix
+ */
+template <typename T>
+General_Matrix<T> load_general_matrix(const string& file_name);
+
+/*! Reads a symmetric matrix from a text file
+ *
+ *  Takes the same files as `load_general_matrix`. Only the lower triangle is parsed: the entries
+ *  of a full row past the diagonal are skipped without being read.
+ *
+ *  \param file_name the file holding the matrix
+ *  \pre T is float, double or long double; a full layout file holds a symmetric matrix
+ *  \return the lower triangle of the matrix
+ *  \throws runtime_error thrown if the file cannot be read or does not hold a square matrix
+ */
+template <typename T>
+Symmetric_Matrix<T> load_symmetric_matrix(const string& file_name);
+
+/*! Reads a square matrix from a text file, keeping a packed lower triangle symmetric
+ *
+ *  \param file_name the file holding the matrix
+ *  \pre T is float, double or long double
+ *  \return a `Symmetric_Matrix` for a packed lower triangle file, a `General_Matrix` otherwise
+ *  \throws runtime_error thrown if the file cannot be read or does not hold a square matrix
+ */
+template <typename T>
+std::unique_ptr<Base_Matrix<T> > load_matrix(const string& file_name);
+
+#include "matrix_loader.hpp"
+#endif
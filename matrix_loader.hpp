@@ -0,0 +1,333 @@
+/*! \file
+ *  Function definitions for the bulk matrix and vector loaders.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+// Whitespace separating numbers (what `istream >> value` skips)
+inline bool is_blank(const char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline const char* skip_blanks(const char* text, const char* end) {
+    while (text < end && is_blank(*text)) { text++; }
+    return text;
+}
+
+inline const char* skip_number(const char* text, const char* end) {
+    while (text < end && !is_blank(*text)) { text++; }
+    return text;
+}
+
+inline void convert_number(const char* text, char** last, float& value) { value = strtof(text, last); }
+inline void convert_number(const char* text, char** last, double& value) { value = strtod(text, last); }
+inline void convert_number(const char* text, char** last, long double& value) { value = strtold(text, last); }
+
+// Reads a plain decimal ("-12", "0.25", "3e-4") whose digits and power of ten are both exact in T,
+// which one correctly rounded multiply or divide turns into the nearest T (Clinger's fast path);
+// returns false for anything else
+template <typename T>
+bool parse_exact_decimal(const char* text, const char* end, T& value) {
+    const int digits = numeric_limits<T>::digits;
+    const int max_power = (digits >= 64) ? 27 : ((digits >= 53) ? 22 : 10);
+    const uint64_t max_mantissa = (digits >= 64) ? ~uint64_t(0) : (uint64_t(1) << (digits & 63)) - 1;
+
+    bool negative = (text < end && *text == '-');
+    if (text < end && (*text == '-' || *text == '+')) { text++; }
+
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int power = 0;
+    bool any_digit = false;
+    for (; text < end && *text >= '0' && *text <= '9'; text++) {
+        any_digit = true;
+        if (mantissa == 0 && *text == '0') { continue; }
+        if (++significant > 19) { return false; }
+        mantissa = mantissa * 10 + uint64_t(*text - '0');
+    }
+    if (text < end && *text == '.') {
+        for (text++; text < end && *text >= '0' && *text <= '9'; text++) {
+            any_digit = true;
+            power--;
+            if (mantissa == 0 && *text == '0') { continue; }
+            if (++significant > 19) { return false; }
+            mantissa = mantissa * 10 + uint64_t(*text - '0');
+        }
+    }
+    if (!any_digit) { return false; }
+
+    if (text < end && (*text == 'e' || *text == 'E')) {
+        text++;
+        bool negative_exponent = (text < end && *text == '-');
+        if (text < end && (*text == '-' || *text == '+')) { text++; }
+        if (text == end) { return false; }
+
+        int exponent = 0;
+        for (; text < end && *text >= '0' && *text <= '9'; text++) {
+            if (exponent > 1000) { return false; }
+            exponent = exponent * 10 + (*text - '0');
+        }
+        power += negative_exponent ? -exponent : exponent;
+    }
+    if (text != end) { return false; }
+
+    if (mantissa == 0) {
+        value = negative ? -T(0) : T(0);
+        return true;
+    }
+    if (mantissa > max_mantissa || power > max_power || power < -max_power) { return false; }
+
+    value = static_cast<T>(mantissa);
+    value = (power < 0) ? value / static_cast<T>(POWERS_OF_TEN[-power]) : value * static_cast<T>(POWERS_OF_TEN[power]);
+    if (negative) { value = -value; }
+
+    return true;
+}
+
+// Parses the number spelled by [begin, end); the mapping has no terminator, so text off the fast path is copied out first
+template <typename T>
+void parse_number(const char* begin, const char* end, T& value) {
+    if (parse_exact_decimal(begin, end, value)) { return; }
+
+    char buffer[MAX_NUMBER_LENGTH + 1];
+    size_t length = size_t(end - begin);
+    if (length > size_t(MAX_NUMBER_LENGTH)) { throw runtime_error("Error: Invalid number \"" + string(begin, MAX_NUMBER_LENGTH) + "...\" in data."); }
+
+    memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char* last = nullptr;
+    convert_number(buffer, &last, value);
+    if (last != buffer + length) { throw runtime_error("Error: Invalid number \"" + string(buffer) + "\" in data."); }
+}
+
+// Parses `count` numbers from [begin, end) into `values` and returns the end of the last one
+template <typename T>
+const char* parse_numbers(const char* begin, const char* end, T* values, const int& count) {
+    for (int k = 0; k < count; k++) {
+        begin = skip_blanks(begin, end);
+        if (begin == end) { throw runtime_error("Error: Insufficient amount of data provided."); }
+
+        const char* last = skip_number(begin, end);
+        parse_number(begin, last, values[k]);
+        begin = last;
+    }
+
+    return begin;
+}
+
+inline int count_numbers(const char* begin, const char* end) {
+    int count = 0;
+    while ((begin = skip_blanks(begin, end)) != end) {
+        begin = skip_number(begin, end);
+        count++;
+    }
+
+    return count;
+}
+
+// Calls body(index, begin, end) for every number in [data, end), in parallel over chunks of the text;
+// a number belongs to the chunk holding its first character
+template <typename Body>
+size_t for_each_number(const char* data, const char* end, const Body& body) {
+    int chunks = int((size_t(end - data) + LOADER_CHUNK_BYTES - 1) / LOADER_CHUNK_BYTES);
+    Vector<size_t> firsts(chunks + 1, 0);
+
+    Task_Scheduler& scheduler = default_scheduler();
+    scheduler.parallel_for(0, chunks, [&](int c) {
+        const char* text = data + size_t(c) * LOADER_CHUNK_BYTES;
+        const char* stop = min(end, text + LOADER_CHUNK_BYTES);
+        if (c > 0 && !is_blank(text[-1])) { text = skip_number(text, stop); }
+
+        size_t count = 0;
+        while ((text = skip_blanks(text, stop)) < stop) {
+            text = skip_number(text, end);
+            count++;
+        }
+        firsts[c + 1] = count;
+    }, 1);
+
+    for (int c = 0; c < chunks; c++) { firsts[c + 1] += firsts[c]; }
+
+    scheduler.parallel_for(0, chunks, [&](int c) {
+        const char* text = data + size_t(c) * LOADER_CHUNK_BYTES;
+        const char* stop = min(end, text + LOADER_CHUNK_BYTES);
+        if (c > 0 && !is_blank(text[-1])) { text = skip_number(text, stop); }
+
+        size_t index = firsts[c];
+        while ((text = skip_blanks(text, stop)) < stop) {
+            const char* last = skip_number(text, end);
+            body(index++, text, last);
+            text = last;
+        }
+    }, 1);
+
+    return firsts[chunks];
+}
+
+template <typename Body>
+size_t for_each_number(const Mapped_File& file, const Body& body) {
+    return for_each_number(file.get_data(), file.get_data() + file.get_size(), body);
+}
+
+// Counts the numbers of a file without parsing them
+inline size_t count_numbers(const Mapped_File& file) {
+    return for_each_number(file, [](size_t, const char*, const char*) {});
+}
+
+// Where the rows of a matrix file are and how they are laid out
+struct Matrix_Text {
+    int size;
+    Matrix_Layout layout;
+    bool by_line;                // one row per line (otherwise the numbers are read as one stream)
+    Vector<const char*> begin;   // rows, by line
+    Vector<const char*> end;
+};
+
+// Finds the size and layout of the matrix in `file`: the lines holding numbers are indexed with
+// memchr, and only the first two lines are read to tell full rows from a packed lower triangle
+inline void inspect_matrix(const Mapped_File& file, Matrix_Text& text) {
+    if (file.get_size() == 0) { throw runtime_error("Error: Insufficient amount of data provided."); }
+    const char* data = file.get_data();
+    const char* stop = data + file.get_size();
+
+    size_t lines = 1;
+    for (const char* line = data; (line = static_cast<const char*>(memchr(line, '\n', size_t(stop - line)))) != nullptr; line++) { lines++; }
+    if (lines > size_t(numeric_limits<int>::max())) { throw runtime_error("Error: Matrix is too large."); }
+
+    text.begin = Vector<const char*>(int(lines), nullptr);
+    text.end = Vector<const char*>(int(lines), nullptr);
+    int rows = 0;
+    for (const char* line = data; line < stop; ) {
+        const char* next = static_cast<const char*>(memchr(line, '\n', size_t(stop - line)));
+        if (next == nullptr) { next = stop; }
+        if (skip_blanks(line, next) != next) {
+            text.begin[rows] = line;
+            text.end[rows] = next;
+            rows++;
+        }
+        line = next + 1;
+    }
+
+    if (rows == 0) { throw runtime_error("Error: Insufficient amount of data provided."); }
+
+    int first = count_numbers(text.begin[0], text.end[0]);
+    text.by_line = true;
+    text.size = rows;
+    if (first == rows) {
+        text.layout = full_layout;
+        return;
+    }
+    if (first == 1 && count_numbers(text.begin[1], text.end[1]) == 2) {
+        text.layout = lower_layout;
+        return;
+    }
+
+    // Rows are not one per line: n * n numbers are a full matrix, n * (n + 1) / 2 a lower triangle
+    text.by_line = false;
+    double count = double(count_numbers(file));
+    size_t full = size_t(llround(sqrt(count)));
+    size_t lower = size_t(llround((sqrt(8 * count + 1) - 1) / 2));
+    if (double(full * full) == count) {
+        text.size = int(full);
+        text.layout = full_layout;
+    }
+    else if (double(lower * (lower + 1) / 2) == count) {
+        text.size = int(lower);
+        text.layout = lower_layout;
+    }
+    else {
+        throw runtime_error("Error: Data does not form a square matrix.");
+    }
+}
+
+// Parses the lower triangle (or, unless `lower_only`, every row in full) of the matrix in `file` into `matrix`
+template <typename T>
+void fill_matrix(const Mapped_File& file, const Matrix_Text& text, General_Matrix<T>& matrix, const bool& lower_only) {
+    const int size = text.size;
+    const bool lower = text.layout == lower_layout;
+
+    if (text.by_line) {
+        default_scheduler().parallel_for(0, size, [&](int i) {
+            int count = (lower || lower_only) ? i + 1 : size;
+            const char* last = parse_numbers(text.begin[i], text.end[i], matrix.get_row_ref(i).get_ptr(), count);
+
+            // Entries past the diagonal of a full row are neither read nor checked for a symmetric matrix
+            if ((lower || !lower_only) && skip_blanks(last, text.end[i]) != text.end[i]) {
+                throw runtime_error("Error: Row " + to_string(i + 1) + " holds more than " + to_string(count) + " entries.");
+            }
+        });
+        return;
+    }
+
+    for_each_number(file, [&](size_t index, const char* begin, const char* end) {
+        size_t row, column;
+        if (lower) {
+            row = size_t((sqrt(8 * double(index) + 1) - 1) / 2);
+            while (row * (row + 1) / 2 > index) { row--; }
+            while ((row + 1) * (row + 2) / 2 <= index) { row++; }
+            column = index - row * (row + 1) / 2;
+        }
+        else {
+            row = index / size_t(size);
+            column = index % size_t(size);
+        }
+
+        if (!lower_only || column <= row) { parse_number(begin, end, matrix.get_row_ref(int(row))[int(column)]); }
+    });
+}
+
+template <typename T>
+Vector<T> load_vector(const string& file_name) {
+    Mapped_File file(file_name);
+    size_t count = count_numbers(file);
+    if (count > size_t(numeric_limits<int>::max())) { throw runtime_error("Error: Vector is too large."); }
+
+    Vector<T> result(int(count), T(0));
+    T* values = result.get_ptr();
+    for_each_number(file, [&](size_t index, const char* begin, const char* end) {
+        parse_number(begin, end, values[index]);
+    });
+
+    return result;
+}
+
+template <typename T>
+General_Matrix<T> load_general_matrix(const string& file_name) {
+    Mapped_File file(file_name);
+    Matrix_Text text;
+    inspect_matrix(file, text);
+
+    General_Matrix<T> result(text.size, T(0));
+    fill_matrix(file, text, result, false);
+
+    return result;
+}
+
+template <typename T>
+Symmetric_Matrix<T> load_symmetric_matrix(const string& file_name) {
+    Mapped_File file(file_name);
+    Matrix_Text text;
+    inspect_matrix(file, text);
+
+    Symmetric_Matrix<T> result(text.size, T(0));
+    fill_matrix(file, text, result, true);
+
+    return result;
+}
+
+template <typename T>
+std::unique_ptr<Base_Matrix<T> > load_matrix(const string& file_name) {
+    Mapped_File file(file_name);
+    Matrix_Text text;
+    inspect_matrix(file, text);
+
+    if (text.layout == lower_layout) {
+        std::unique_ptr<Symmetric_Matrix<T> > result(new Symmetric_Matrix<T>(text.size, T(0)));
+        fill_matrix(file, text, *result, true);
+        return std::unique_ptr<Base_Matrix<T> >(result.release());
+    }
+
+    std::unique_ptr<General_Matrix<T> > result(new General_Matrix<T>(text.size, T(0)));
+    fill_matrix(file, text, *result, false);
+    return std::unique_ptr<Base_Matrix<T> >(result.release());
+}
@@ -0,0 +1,91 @@
+/*! \file
+ *  Matrix Market (.mtx) reading and writing.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef MATRIX_MARKET_H
+#define MATRIX_MARKET_H
+#include "libraries.h"
+#include "sparse_matrix.h"
+#include "matrix_loader.h"
+#include "solution_writer.h"
+
+/*! Layout of the entries of a Matrix Market file */
+enum Market_Format {
+    coordinate_format,  //!< one "row column value" line per stored entry (sparse)
+    array_format        //!< every value, column by column (dense)
+};
+
+/*! Kind of value stored in a Matrix Market file */
+enum Market_Field {
+    real_field,
+    integer_field,
+    pattern_field       //!< coordinate entries without a value (read as 1)
+};
+
+/*! What the banner and size line of a Matrix Market file say about its matrix */
+struct Market_Header {
+    Market_Format format;
+    Market_Field field;
+    bool symmetric;         //!< only the lower triangle is stored
+    int size;               //!< rows (and columns)
+    size_t entries;         //!< stored entries: coordinate lines, or values of an array
+    size_t data_offset;     //!< where the entries start in the file
+};
+
+/*! Reads the banner and size line of a Matrix Market file
+ *
+ *  \param file the mapped file
+ *  \param file_name the name of the file (for error messages)
+ *  \return the header
+ *  \throws runtime_error thrown if the file is not a square real, integer or pattern matrix with
+ *          the general or symmetric qualifier
+ */
+inline Market_Header read_market_header(const Mapped_File& file, const string& file_name);
+
+/*! Reads a Matrix Market file into sparse storage
+ *
+ *  Coordinate entries go straight into compressed rows; an array file is read dense and compressed.
+ *
+ *  \param file_name the .mtx file
+ *  \pre T is float, double or long double
+ *  \return the matrix, symmetric if the file is
+ *  \throws runtime_error thrown if the file cannot be read or holds an unsupported matrix
+ */
+template <typename T>
+Sparse_Matrix<T> load_sparse_market(const string& file_name);
+
+/*! Reads a Matrix Market file into dense storage
+ *
+ *  \param file_name the .mtx file
+ *  \pre T is float, double or long double
+ *  \return a `Symmetric_Matrix` if the file is symmetric, a `General_Matrix` otherwise
+ *  \throws runtime_error thrown if the file cannot be read or holds an unsupported matrix
+ */
+template <typename T>
+std::unique_ptr<Base_Matrix<T> > load_dense_market(const string& file_name);
+
+/*! Writes a sparse matrix as a Matrix Market coordinate file (the lower triangle if it is symmetric)
+ *
+ *  Values are written with enough digits to be read back exactly.
+ *
+ *  \param matrix the matrix to write
+ *  \param file_name the file to create (truncated if it exists)
+ *  \throws runtime_error thrown if the file cannot be written
+ */
+template <typename T>
+void write_market(const Sparse_Matrix<T>& matrix, const string& file_name);
+
+/*! Writes a dense matrix as a Matrix Market file (the lower triangle if it is symmetric)
+ *
+ *  \param matrix the matrix to write
+ *  \param file_name the file to create (truncated if it exists)
+ *  \param format array_format for every value, coordinate_format for the non-zero entries only
+ *  \throws runtime_error thrown if the file cannot be written
+ */
+template <typename T>
+void write_market(const Base_Matrix<T>& matrix, const string& file_name, const Market_Format& format = array_format);
+
+#include "matrix_market.hpp"
+#endif
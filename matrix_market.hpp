@@ -0,0 +1,306 @@
+/*! \file
+ *  Function definitions for Matrix Market (.mtx) reading and writing.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+// Splits the line starting at `text` into words and moves `text` to the next line
+inline Vector<string> next_market_line(const char*& text, const char* end) {
+    const char* stop = static_cast<const char*>(memchr(text, '\n', size_t(end - text)));
+    if (stop == nullptr) { stop = end; }
+
+    Vector<string> words;
+    const char* word = text;
+    while ((word = skip_blanks(word, stop)) < stop) {
+        const char* last = skip_number(word, stop);
+        string lower(word, last);
+        transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return char(tolower(c)); });
+        words.push_back(lower);
+        word = last;
+    }
+
+    text = (stop == end) ? end : stop + 1;
+    return words;
+}
+
+// Reads a count or index (digits only)
+inline bool parse_count(const string& word, size_t& value) {
+    if (word.empty() || word.size() > 18) { return false; }
+
+    value = 0;
+    for (size_t k = 0; k < word.size(); k++) {
+        if (word[k] < '0' || word[k] > '9') { return false; }
+        value = value * 10 + size_t(word[k] - '0');
+    }
+
+    return true;
+}
+
+// Reads a 1-based index of a matrix of `size` rows as a 0-based one
+inline int parse_market_index(const char* begin, const char* end, const int& size) {
+    size_t value = 0;
+    if (!parse_count(string(begin, end), value) || value < 1 || value > size_t(size)) {
+        throw runtime_error("Error: Matrix Market entry index " + string(begin, end) + " is outside the matrix.");
+    }
+
+    return int(value) - 1;
+}
+
+inline Market_Header read_market_header(const Mapped_File& file, const string& file_name) {
+    const char* text = file.get_data();
+    const char* end = text + file.get_size();
+    const string not_market = "Error: " + file_name + " is not a Matrix Market matrix file.";
+    if (file.get_size() == 0) { throw runtime_error(not_market); }
+
+    Vector<string> banner = next_market_line(text, end);
+    if (banner.get_size() != 5 || banner[0] != "%%matrixmarket" || banner[1] != "matrix") { throw runtime_error(not_market); }
+
+    Market_Header header;
+    if (banner[2] == "coordinate") { header.format = coordinate_format; }
+    else if (banner[2] == "array") { header.format = array_format; }
+    else { throw runtime_error(not_market); }
+
+    if (banner[3] == "real" || banner[3] == "double") { header.field = real_field; }
+    else if (banner[3] == "integer") { header.field = integer_field; }
+    else if (banner[3] == "pattern" && header.format == coordinate_format) { header.field = pattern_field; }
+    else { throw runtime_error("Error: " + file_name + " holds " + banner[3] + " " + banner[2] + " values, which are not supported."); }
+
+    if (banner[4] == "general") { header.symmetric = false; }
+    else if (banner[4] == "symmetric") { header.symmetric = true; }
+    else { throw runtime_error("Error: " + file_name + " uses the " + banner[4] + " qualifier, which is not supported."); }
+
+    // Comments and blank lines come before the size line
+    Vector<string> sizes;
+    while (text < end && sizes.get_size() == 0) {
+        if (*text == '%') {
+            next_market_line(text, end);
+            continue;
+        }
+        sizes = next_market_line(text, end);
+    }
+
+    size_t rows = 0, columns = 0, entries = 0;
+    if (sizes.get_size() != (header.format == coordinate_format ? 3 : 2) || !parse_count(sizes[0], rows) || !parse_count(sizes[1], columns)
+        || (header.format == coordinate_format && !parse_count(sizes[2], entries))) {
+        throw runtime_error("Error: " + file_name + " has no valid size line.");
+    }
+    if (rows != columns) { throw runtime_error("Error: " + file_name + " holds a " + sizes[0] + " x " + sizes[1] + " matrix; only square matrices are supported."); }
+    if (rows > size_t(numeric_limits<int>::max())) { throw runtime_error("Error: " + file_name + " holds too large a matrix."); }
+
+    header.size = int(rows);
+    header.entries = (header.format == coordinate_format) ? entries : (header.symmetric ? rows * (rows + 1) / 2 : rows * rows);
+    header.data_offset = size_t(text - file.get_data());
+    if (header.entries > size_t(numeric_limits<int>::max())) { throw runtime_error("Error: " + file_name + " holds too many entries."); }
+
+    return header;
+}
+
+// Parses the "row column [value]" entries of a coordinate file (0-based indices; pattern values are 1)
+template <typename T>
+void read_market_entries(const Mapped_File& file, const Market_Header& header, const string& file_name, Vector<int>& rows, Vector<int>& columns, Vector<T>& values) {
+    const size_t per_entry = (header.field == pattern_field) ? 2 : 3;
+    const int count = int(header.entries);
+    rows = Vector<int>(count, 0);
+    columns = Vector<int>(count, 0);
+    values = Vector<T>(count, T(1));
+    int* row = rows.get_ptr();
+    int* column = columns.get_ptr();
+    T* value = values.get_ptr();
+
+    size_t numbers = for_each_number(file.get_data() + header.data_offset, file.get_data() + file.get_size(), [&](size_t index, const char* begin, const char* end) {
+        size_t entry = index / per_entry;
+        if (entry >= header.entries) { return; }
+
+        switch (index % per_entry) {
+            case 0: row[entry] = parse_market_index(begin, end, header.size); break;
+            case 1: column[entry] = parse_market_index(begin, end, header.size); break;
+            default: parse_number(begin, end, value[entry]); break;
+        }
+    });
+
+    if (numbers != header.entries * per_entry) {
+        throw runtime_error("Error: " + file_name + " holds " + to_string(numbers) + " numbers after its size line where "
+                            + to_string(header.entries * per_entry) + " were expected.");
+    }
+}
+
+// Parses the values of an array file (column by column, from the diagonal down if symmetric) into `matrix`
+template <typename T>
+void read_market_array(const Mapped_File& file, const Market_Header& header, const string& file_name, General_Matrix<T>& matrix) {
+    const size_t size = size_t(header.size);
+
+    size_t numbers = for_each_number(file.get_data() + header.data_offset, file.get_data() + file.get_size(), [&](size_t index, const char* begin, const char* end) {
+        if (index >= header.entries) { return; }
+
+        size_t row, column;
+        if (header.symmetric) {
+            // Column j starts at j * size - j * (j - 1) / 2
+            double b = double(2 * size + 1);
+            column = size_t((b - sqrt(max(0.0, b * b - 8 * double(index)))) / 2);
+            while (column > 0 && column * (2 * size - column + 1) / 2 > index) { column--; }
+            while ((column + 1) * (2 * size - column) / 2 <= index) { column++; }
+            row = column + (index - column * (2 * size - column + 1) / 2);
+        }
+        else {
+            row = index % size;
+            column = index / size;
+        }
+
+        parse_number(begin, end, matrix.get_row_ref(int(row)).get_ptr()[column]);
+    });
+
+    if (numbers != header.entries) {
+        throw runtime_error("Error: " + file_name + " holds " + to_string(numbers) + " values after its size line where " + to_string(header.entries) + " were expected.");
+    }
+}
+
+template <typename T>
+Sparse_Matrix<T> load_sparse_market(const string& file_name) {
+    Mapped_File file(file_name);
+    Market_Header header = read_market_header(file, file_name);
+
+    if (header.format == array_format) {
+        std::unique_ptr<Base_Matrix<T> > dense = load_dense_market<T>(file_name);
+        return Sparse_Matrix<T>(*dense);
+    }
+
+    Vector<int> rows, columns;
+    Vector<T> values;
+    read_market_entries(file, header, file_name, rows, columns, values);
+
+    return make_sparse_matrix(header.size, rows, columns, values, header.symmetric);
+}
+
+template <typename T>
+std::unique_ptr<Base_Matrix<T> > load_dense_market(const string& file_name) {
+    Mapped_File file(file_name);
+    Market_Header header = read_market_header(file, file_name);
+
+    std::unique_ptr<General_Matrix<T> > matrix;
+    if (header.symmetric) { matrix.reset(new Symmetric_Matrix<T>(header.size, T(0))); }
+    else { matrix.reset(new General_Matrix<T>(header.size, T(0))); }
+
+    if (header.format == array_format) {
+        read_market_array(file, header, file_name, *matrix);
+    }
+    else {
+        Vector<int> rows, columns;
+        Vector<T> values;
+        read_market_entries(file, header, file_name, rows, columns, values);
+
+        // Repeated entries are summed; a symmetric matrix keeps its entries in the lower triangle
+        for (int k = 0; k < rows.get_size(); k++) {
+            int row = rows.get_ptr()[k];
+            int column = columns.get_ptr()[k];
+            if (header.symmetric && column > row) { swap(row, column); }
+            matrix->get_row_ref(row).get_ptr()[column] += values.get_ptr()[k];
+        }
+    }
+
+    return std::unique_ptr<Base_Matrix<T> >(matrix.release());
+}
+
+// Banner and size line of a real Matrix Market file
+inline string market_banner(const Market_Format& format, const bool& symmetric, const int& size, const size_t& entries) {
+    string banner = string("%%MatrixMarket matrix ") + (format == coordinate_format ? "coordinate" : "array") + " real " + (symmetric ? "symmetric" : "general") + "\n";
+    banner += to_string(size) + " " + to_string(size);
+    if (format == coordinate_format) { banner += " " + to_string(entries); }
+
+    return banner + "\n";
+}
+
+// Appends "value\n" or "row column value\n" (1-based) with `digits` significant digits, enough to read the value back exactly
+inline void append_market_value(string& text, const double value, const int digits) {
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%.*g\n", digits, value);
+    text.append(buffer, size_t(length));
+}
+
+inline void append_market_value(string& text, const long double value, const int digits) {
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%.*Lg\n", digits, value);
+    text.append(buffer, size_t(length));
+}
+
+inline void append_market_entry(string& text, const int row, const int column, const double value, const int digits) {
+    char buffer[96];
+    int length = snprintf(buffer, sizeof(buffer), "%d %d %.*g\n", row + 1, column + 1, digits, value);
+    text.append(buffer, size_t(length));
+}
+
+inline void append_market_entry(string& text, const int row, const int column, const long double value, const int digits) {
+    char buffer[96];
+    int length = snprintf(buffer, sizeof(buffer), "%d %d %.*Lg\n", row + 1, column + 1, digits, value);
+    text.append(buffer, size_t(length));
+}
+
+template <typename T>
+void write_market(const Sparse_Matrix<T>& matrix, const string& file_name) {
+    const int size = matrix.get_size();
+    const bool symmetric = matrix.is_symmetric();
+    const int digits = numeric_limits<T>::max_digits10;
+    const int* start = matrix.get_row_start().get_ptr();
+    const int* column = matrix.get_columns().get_ptr();
+    const T* value = matrix.get_values().get_ptr();
+
+    size_t entries = size_t(matrix.get_nonzero_count());
+    if (symmetric) {
+        entries = 0;
+        for (int i = 0; i < size; i++) {
+            entries += size_t(upper_bound(column + start[i], column + start[i + 1], i) - (column + start[i]));
+        }
+    }
+    const string banner = market_banner(coordinate_format, symmetric, size, entries);
+
+    // Blocks of rows holding about TEXT_CHUNK_LINES entries
+    size_t per_row = max(size_t(1), size_t(matrix.get_nonzero_count()) / size_t(max(size, 1)));
+    int rows_per_chunk = int(max(size_t(1), size_t(TEXT_CHUNK_LINES) / per_row));
+    int chunks = max(1, (size + rows_per_chunk - 1) / rows_per_chunk);
+
+    write_chunked_text(file_name, chunks, [&](int chunk, string& text) {
+        if (chunk == 0) { text += banner; }
+        int last = min(size, (chunk + 1) * rows_per_chunk);
+        for (int i = chunk * rows_per_chunk; i < last; i++) {
+            for (int k = start[i]; k < start[i + 1] && (!symmetric || column[k] <= i); k++) {
+                append_market_entry(text, i, column[k], value[k], digits);
+            }
+        }
+    });
+
+    return;
+}
+
+template <typename T>
+void write_market(const Base_Matrix<T>& matrix, const string& file_name, const Market_Format& format) {
+    const int size = matrix.get_size();
+    const bool lower_only = matrix.get_status() == symmetric;
+    const int digits = numeric_limits<T>::max_digits10;
+
+    // Entries are written column by column, from the diagonal down if symmetric
+    size_t entries = 0;
+    if (format == coordinate_format) {
+        for (int j = 0; j < size; j++) {
+            for (int i = lower_only ? j : 0; i < size; i++) {
+                if (matrix.get_element(i, j) != T(0)) { entries++; }
+            }
+        }
+    }
+    const string banner = market_banner(format, lower_only, size, entries);
+
+    int columns_per_chunk = max(1, TEXT_CHUNK_LINES / max(size, 1));
+    int chunks = max(1, (size + columns_per_chunk - 1) / columns_per_chunk);
+
+    write_chunked_text(file_name, chunks, [&](int chunk, string& text) {
+        if (chunk == 0) { text += banner; }
+        int last = min(size, (chunk + 1) * columns_per_chunk);
+        for (int j = chunk * columns_per_chunk; j < last; j++) {
+            for (int i = lower_only ? j : 0; i < size; i++) {
+                T value = matrix.get_element(i, j);
+                if (format == array_format) { append_market_value(text, value, digits); }
+                else if (value != T(0)) { append_market_entry(text, i, j, value, digits); }
+            }
+        }
+    });
+
+    return;
+}
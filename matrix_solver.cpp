@@ -0,0 +1,24 @@
+/*! \file
+ *  Explicit instantiations of the solvers for every runtime precision (float, double, long double).
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#include "matrix_solver.h"
+#include "heat_solver.h"
+
+template class Gaussian_Solver<float>;
+template class Gaussian_Solver<double>;
+template class Gaussian_Solver<long double>;
+template class Cholesky_Solver<float>;
+template class Cholesky_Solver<double>;
+template class Cholesky_Solver<long double>;
+template class Conjugate_Gradient_Solver<float>;
+template class Conjugate_Gradient_Solver<double>;
+template class Conjugate_Gradient_Solver<long double>;
+template class Matrix_Solver<float>;
+template class Matrix_Solver<double>;
+template class Matrix_Solver<long double>;
+template class Heat_Solver<float>;
+template class Heat_Solver<double>;
+template class Heat_Solver<long double>;
@@ -6,7 +6,47 @@
 #define MATRIX_SOLVER_H
 #include "gaussian_solver.h"
 #include "cholesky_solver.h"
+#include "fixed_mesh_solver.h"
+#include "symmetric_matrix.h"
+#include "conjugate_gradient_solver.h"
+#include "stencil_operator_2d.h"
+#include "stencil_operator_3d.h"
+#include "iterative_batch.h"
+#include "task_scheduler.h"
+#include "solve_handle.h"
+#include "factor_checkpoint.h"
+#include "factor_cache.h"
+#include "solve_stats.h"
+#include "grid_2d.h"
+#include "solution_writer.h"
+#include "matrix_loader.h"
+#include "matrix_market.h"
 #include "generators.hpp"
+#include "generators_3d.hpp"
+
+/*! Floating point type a solver is instantiated with, selected at runtime */
+enum Precision { float_precision, double_precision, long_double_precision };
+
+/*! Gets the name of a precision ("float", "double" or "long double") */
+inline string precision_name(const Precision& precision) {
+    if (precision == float_precision) return "float";
+    if (precision == double_precision) return "double";
+    return "long double";
+}
+
+/*! Factorization a solver uses for its matrix (recorded in factor checkpoints) */
+enum Factor_Kind { no_factor, cholesky_factor, gaussian_factor, fixed_mesh_factor };
+
+/*! A factorization shared between solvers through the factor cache
+ *
+ *  Gaussian elimination substitutes through its source matrix, so that factorization keeps its own
+ *  copy of the matrix; the Cholesky factorizations are self-contained and leave `matrix` empty.
+ */
+template <class T>
+struct Cached_Factor {
+    std::unique_ptr<Base_Matrix<T> > matrix;
+    std::unique_ptr<Solver_Strategy<T> > method;
+};
 
 /*! Matrix solver class */
 template <class T>
@@ -14,11 +54,82 @@ class Matrix_Solver {
     private:
         // Matrix-vector containers
         int m_size;
-        Base_Matrix<T>* m_matrix;
+        const Base_Matrix<T>* m_matrix;
+        bool m_owns_matrix;
         Vector<T> m_vec;
 
-        // Solving strategy 
+        // Mesh length and stencil of a generated 2D system (mesh length 0 otherwise); small meshes get a
+        // `Fixed_Mesh_Solver`, and mesh factorizations are shared through the factor cache
+        int m_mesh_length;
+        Stencil m_stencil;
+
+        // Matrix-free or sparse operator (used instead of `m_matrix` when no dense matrix is stored)
+        const Linear_Operator<T>* m_operator;
+        bool m_owns_operator;
+
+        // Solving strategy (holds the factorization once `factorize` has been called); owned by the
+        // solver unless it belongs to the shared factorization
         Solver_Strategy<T>* m_method;
+        std::shared_ptr<Cached_Factor<T> > m_shared_factor;
+
+        // Non-virtual entry point of m_method when it is a `Fixed_Mesh_Solver` (solver nullptr otherwise)
+        Fixed_Mesh_Kernel<T> m_fixed_kernel;
+
+        // Measurements (only taken while m_stats_enabled, apart from the assembly time); solves may run concurrently
+        bool m_stats_enabled;
+        Solve_Stats m_stats;
+        mutable std::mutex m_stats_mutex;
+
+        /*! Factors the matrix with `control` (may be nullptr) attached to the factorization
+          *
+          * \post the factorization is stored, or discarded if the factorization threw
+        */
+        void factorize(Solve_Control* control);
+
+        /*! Selects the solving strategy and factors the matrix with `control` attached (see `factorize`) */
+        void select_method(Solve_Control* control);
+
+        /*! Substitutes `rhs` with the stored factorization, measuring the solve if statistics are enabled
+          *
+          * \pre `factorize` has been called
+          * \return the solution of the system for `rhs`
+        */
+        Vector<T> run_substitution(const Vector<T>& rhs);
+
+        /*! Adds what an `Allocation_Scope` measured to the statistics
+          *
+          * \pre m_stats_mutex is held
+        */
+        void add_allocations(const Allocation_Stats& allocated);
+
+        /*! Gets the factorization `factorize` uses for the stored matrix (no_factor for operators
+          * and row reduced matrices)
+        */
+        Factor_Kind get_factor_kind() const;
+
+        /*! Creates the (unfactored) strategy for a factorization kind
+          *
+          * \pre kind != no_factor
+          * \post the caller owns the returned strategy
+        */
+        Solver_Strategy<T>* create_method(const Factor_Kind& kind) const;
+
+        /*! Factors the matrix into a new shareable factorization (see factor_cache)
+          *
+          * \param kind the factorization to perform
+          * \param control watches the factorization (may be nullptr)
+          * \param bytes set to the approximate memory held by the factorization
+          * \return the factorization
+          * \throws rethrows the exceptions of the factorization
+        */
+        std::shared_ptr<Cached_Factor<T> > build_shared_factor(const Factor_Kind& kind, Solve_Control* control, size_t& bytes) const;
+
+        /*! Sets up the finite difference system for a mesh whose boundary values are on the ring of `padded`
+          *
+          * \pre mesh_length > 1
+          * \post the coefficient matrix (general if `gauss_override`) and b vector are generated
+        */
+        void init_mesh(const int& mesh_length, const bool& gauss_override, const Vector<T>& padded, const Stencil& stencil, const chrono::steady_clock::time_point& start);
 
     public:
         /*! Constructor for a given matrix-vector pair
@@ -26,11 +137,23 @@ class Matrix_Solver {
           * \param matrix the matrix to solve
           * \param vec the solution vector that is paired with `matrix`
           * 
-          * \pre none
+          * \pre `matrix` outlives the solver (it is referenced, not copied)
           * \post solver class is constructed with given matrix-vector pair
         */
         Matrix_Solver(const Base_Matrix<T>& matrix, const Vector<T>& vec);
 
+        /*! Constructor for a given operator-vector pair, e.g. a `Sparse_Matrix` read from a Matrix
+          * Market file. The system is solved iteratively.
+          *
+          * \param op the operator to solve
+          * \param vec the solution vector that is paired with `op`
+          * 
+          * \pre `op` is symmetric positive definite
+          * \pre `op` outlives the solver (it is referenced, not copied)
+          * \post solver class is constructed with given operator-vector pair
+        */
+        Matrix_Solver(const Linear_Operator<T>& op, const Vector<T>& vec);
+
         /*! Constructor to generate a matrix-vector pair via the finite difference
           * method
           *
@@ -42,6 +165,7 @@ class Matrix_Solver {
           * \param lower a pointer to the lower boundary function
           * \param right a pointer to the right boundary function
           * \param left a pointer to the left boundary function
+          * \param stencil the finite difference stencil to assemble the system with
           * 
           * \pre upper_bound > lower_bound
           * \pre mesh_length > 0
@@ -49,10 +173,85 @@ class Matrix_Solver {
           *       finite difference method
           * \throws domain_error thrown if pre-conditions broken
         */
-        Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double));
+        Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double), const Stencil& stencil = five_point);
+
+        /*! Constructor to generate a matrix-vector pair via the finite difference
+          * method from batched boundary functions (each is called once for its whole edge)
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param mesh_length the mesh length
+          * \param gauss_override flag to force gaussian elimination strategy
+          * \param upper the batched upper boundary function
+          * \param lower the batched lower boundary function
+          * \param right the batched right boundary function
+          * \param left the batched left boundary function
+          * \param stencil the finite difference stencil to assemble the system with
+          * 
+          * \pre upper_bound > lower_bound
+          * \pre mesh_length > 0
+          * \post solver class is constructed with matrix-vector pair utilizing
+          *       finite difference method
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, Batch_Boundary upper, Batch_Boundary lower, Batch_Boundary right, Batch_Boundary left, const Stencil& stencil = five_point);
+
+        /*! Constructor to generate a matrix-vector pair via the finite difference
+          * method from any boundary callables taking (x, y), e.g. lambdas (called directly, so they can be inlined)
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param mesh_length the mesh length
+          * \param gauss_override flag to force gaussian elimination strategy
+          * \param upper the upper boundary function
+          * \param lower the lower boundary function
+          * \param right the right boundary function
+          * \param left the left boundary function
+          * \param stencil the finite difference stencil to assemble the system with
+          * 
+          * \pre upper_bound > lower_bound
+          * \pre mesh_length > 0
+          * \pre each boundary function is callable as double(double, double)
+          * \post solver class is constructed with matrix-vector pair utilizing
+          *       finite difference method
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        template <typename Upper, typename Lower, typename Right, typename Left>
+        Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, const Upper& upper, const Lower& lower, const Right& right, const Left& left, const Stencil& stencil = five_point);
+
+        /*! Constructor to generate a matrix-free operator-vector pair for the cube mesh via the
+          * finite difference method (7-point stencil). The system is solved iteratively.
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param mesh_length the mesh length
+          * \param upper a pointer to the upper (y = upper_bound) boundary function
+          * \param lower a pointer to the lower (y = lower_bound) boundary function
+          * \param right a pointer to the right (x = upper_bound) boundary function
+          * \param left a pointer to the left (x = lower_bound) boundary function
+          * \param front a pointer to the front (z = upper_bound) boundary function
+          * \param back a pointer to the back (z = lower_bound) boundary function
+          * 
+          * \pre upper_bound > lower_bound
+          * \pre mesh_length > 1
+          * \post solver class is constructed with a `Stencil_Operator_3D` and its b vector
+          * \throws domain_error thrown if pre-conditions broken
+        */
+        Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, double (*upper)(double, double, double), double (*lower)(double, double, double), double (*right)(double, double, double), double (*left)(double, double, double), double (*front)(double, double, double), double (*back)(double, double, double));
 
         /* Destructor */
-        ~Matrix_Solver() { if (m_matrix != nullptr) delete m_matrix; }
+        ~Matrix_Solver();
+
+        /*! Selects the solver strategy and factors the matrix (only done once per solver)
+          *
+          * Solvers of generated 2D meshes share their factorization through the process-wide
+          * factor cache, keyed by stencil, mesh length, precision and strategy: a solver for a mesh
+          * that was factored before (or is being factored by another thread) reuses that factorization.
+          * 
+          * \pre pre-conditions for the selected strategy should be met
+          * \post the factorization is stored and reused by every subsequent solve
+        */
+        void factorize();
 
         /*! Driver function to select solver strategy and begin solving process
           * 
@@ -64,7 +263,149 @@ class Matrix_Solver {
           * \throws domain_error thrown if size of parameters are not equal
         */
         Vector<T> solve();
+
+        /*! Solves the matrix against a new right hand side, reusing the stored factorization
+          * 
+          * \param rhs the right hand side vector
+          * \return a vector containing the solution to matrix * x = rhs
+          * 
+          * \pre pre-conditions for auxiliary functions should be met
+          * \pre rhs.get_size() == size of the matrix
+          * \post the matrix is factored if it has not been already
+          * \post (see return)
+          * \throws domain_error thrown if size of parameters are not equal
+        */
+        Vector<T> solve(const Vector<T>& rhs);
+
+        /*! Solves the matrix against several right hand sides (e.g. the same mesh with different
+          * boundary functions), reusing the stored factorization. The right hand sides are packed
+          * SIMD_LANES at a time into interleaved blocks that are substituted lane-parallel, and the
+          * blocks are solved concurrently on the default scheduler.
+          * 
+          * \param rhs_columns the right hand side vectors
+          * \return the solution for every right hand side, in the same order
+          * 
+          * \pre every rhs_columns[i].get_size() == size of the matrix
+          * \post the matrix is factored if it has not been already
+          * \post (see return)
+          * \throws domain_error thrown if size of parameters are not equal
+        */
+        Vector<Vector<T> > solve(const Vector<Vector<T> >& rhs_columns);
+
+        /*! Solves the matrix against a right hand side held in raw storage, reusing the stored
+          * factorization. Meshes up to FIXED_MESH_LIMIT go straight to the `Fixed_Mesh_Solver`
+          * kernel, without the `Solver_Strategy` interface or heap allocation, unless statistics
+          * are enabled; everything else takes the path of `solve(const Vector<T>&)`.
+          *
+          * \param rhs the get_size() entries of the right hand side
+          * \param solution receives the get_size() entries of the solution (may be `rhs`)
+          *
+          * \post the matrix is factored if it has not been already
+          * \post solution holds the solution to matrix * x = rhs
+        */
+        void solve(const T* rhs, T* solution);
+
+        /*! Starts solving against the stored vector in the background
+          * 
+          * \return a handle to wait for, cancel, or query the progress of the solve
+          * 
+          * \pre the solver outlives the handle, and is not otherwise used until the solve has finished
+          * \post the matrix is factored if it has not been already (unless cancelled)
+        */
+        Solve_Handle<T> solve_async() { return solve_async(m_vec); }
+
+        /*! Starts solving against a new right hand side in the background
+          * 
+          * \param rhs the right hand side vector
+          * \return a handle to wait for, cancel, or query the progress of the solve
+          * 
+          * \pre the solver outlives the handle, and is not otherwise used until the solve has finished
+          * \pre rhs.get_size() == size of the matrix
+          * \post the matrix is factored if it has not been already (unless cancelled)
+          * \throws domain_error thrown if size of parameters are not equal
+        */
+        Solve_Handle<T> solve_async(const Vector<T>& rhs);
+
+        /*! Saves the factorization to a checkpoint file, factoring the matrix first if needed
+          *
+          * The file holds a versioned header (strategy, precision, size, mesh length and checksums of
+          * the matrix and of the factor) followed by the raw factor (see Factor_Header).
+          *
+          * \param file_name the checkpoint to create (replaced if it exists)
+          *
+          * \pre the solver stores a matrix (not a matrix-free operator) that is not already row reduced
+          * \post the checkpoint is written
+          * \throws runtime_error thrown if there is no factor to save or the file cannot be written
+        */
+        void save_factor(const string& file_name);
+
+        /*! Loads a factorization saved by `save_factor` in place of factoring the matrix
+          *
+          * The file is mapped and only accepted if it was written for this matrix (same strategy,
+          * precision, size, mesh length and matrix checksum) and its factor checksum matches; the factor
+          * is then copied out of the mapping.
+          *
+          * \param file_name the checkpoint to load
+          *
+          * \pre none
+          * \post the loaded factorization replaces any stored one; on failure nothing changes
+          * \throws runtime_error thrown if the file cannot be read, is damaged or belongs to another matrix
+        */
+        void load_factor(const string& file_name);
+
+        /*! Turns the collection of statistics on or off
+          *
+          * Statistics are off by default (unless SOLVE_STATS_VARIABLE is set), in which case solves
+          * take no measurements at all. The assembly time of mesh solvers is always recorded.
+          *
+          * \param enabled whether factorizations and solves are measured from now on
+          * \post see get_stats
+        */
+        void set_stats_enabled(const bool& enabled) { std::lock_guard<std::mutex> lock(m_stats_mutex); m_stats_enabled = enabled; }
+
+        /*! Gets whether statistics are being collected */
+        bool get_stats_enabled() const { std::lock_guard<std::mutex> lock(m_stats_mutex); return m_stats_enabled; }
+
+        /*! Gets the statistics collected so far (see Solve_Stats)
+          *
+          * Iterative solves are timed through their substitution, where the iterations happen; the
+          * residual is computed from the stored matrix or operator after each single solve.
+          * Allocations are those of `Vector` storage (every matrix and factorization is built on it),
+          * counted while the factorization and the solves run.
+          *
+          * \return the measurements taken while statistics were enabled
+        */
+        Solve_Stats get_stats() const;
+
+        /*! Clears the measurements of the solves and the allocation counts (the assembly and factorization times, bytes and flops are kept) */
+        void reset_stats();
+
+        /*! Sets the number of threads used by the library (the default scheduler)
+          * 
+          * \param num_threads the thread count, including the calling thread
+          * 
+          * \pre no solve is running
+          * \post every subsequent parallel section runs on `num_threads` threads
+        */
+        static void set_num_threads(const int& num_threads) { default_scheduler().resize(num_threads); }
+
+        /*! Gets the number of threads used by the library (the default scheduler) */
+        static int get_num_threads() { return default_scheduler().get_num_threads(); }
 };
 
 #include "matrix_solver.hpp"
+
+// Every precision is instantiated once, in matrix_solver.cpp
+extern template class Gaussian_Solver<float>;
+extern template class Gaussian_Solver<double>;
+extern template class Gaussian_Solver<long double>;
+extern template class Cholesky_Solver<float>;
+extern template class Cholesky_Solver<double>;
+extern template class Cholesky_Solver<long double>;
+extern template class Conjugate_Gradient_Solver<float>;
+extern template class Conjugate_Gradient_Solver<double>;
+extern template class Conjugate_Gradient_Solver<long double>;
+extern template class Matrix_Solver<float>;
+extern template class Matrix_Solver<double>;
+extern template class Matrix_Solver<long double>;
 #endif
\ No newline at end of file
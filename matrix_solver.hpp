@@ -5,42 +5,471 @@
 //Programmers: Zachary Bahr and Jacob LeGrand
 
 template <typename T>
-Matrix_Solver<T>::Matrix_Solver(const Base_Matrix<T>& matrix, const Vector<T>& vec) : m_size(matrix.get_size()), m_matrix(&matrix), m_vec(vec), m_method(nullptr) {}
+Matrix_Solver<T>::Matrix_Solver(const Base_Matrix<T>& matrix, const Vector<T>& vec) : m_size(matrix.get_size()), m_matrix(&matrix), m_owns_matrix(false), m_vec(vec), m_mesh_length(0), m_stencil(five_point), m_operator(nullptr), m_owns_operator(false), m_method(nullptr), m_fixed_kernel(get_fixed_mesh_kernel<T>(nullptr, 0)), m_stats_enabled(solve_stats_default()), m_stats(empty_solve_stats()) {}
 
 template <typename T>
-Matrix_Solver<T>::Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double)) {
+Matrix_Solver<T>::Matrix_Solver(const Linear_Operator<T>& op, const Vector<T>& vec) : m_size(op.get_size()), m_matrix(nullptr), m_owns_matrix(false), m_vec(vec), m_mesh_length(0), m_stencil(five_point), m_operator(&op), m_owns_operator(false), m_method(nullptr), m_fixed_kernel(get_fixed_mesh_kernel<T>(nullptr, 0)), m_stats_enabled(solve_stats_default()), m_stats(empty_solve_stats()) {}
+
+template <typename T>
+void Matrix_Solver<T>::init_mesh(const int& mesh_length, const bool& gauss_override, const Vector<T>& padded, const Stencil& stencil, const chrono::steady_clock::time_point& start) {
+    m_size = (mesh_length - 1) * (mesh_length - 1);
+    m_matrix = gauss_override ? (new General_Matrix<T>(gen_coefficient_matrix<T>(mesh_length, stencil))) : (new Symmetric_Matrix<T>(gen_coefficient_matrix<T>(mesh_length, stencil)));
+    m_owns_matrix = true;
+    m_vec = gen_callback_vec<T>(mesh_length, padded, stencil);
+    m_mesh_length = mesh_length;
+    m_stencil = stencil;
+    m_operator = nullptr;
+    m_owns_operator = false;
+    m_method = nullptr;
+    m_fixed_kernel = get_fixed_mesh_kernel<T>(nullptr, 0);
+    m_stats_enabled = solve_stats_default();
+    m_stats = empty_solve_stats();
+    m_stats.assembly_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    return;
+}
+
+template <typename T>
+Matrix_Solver<T>::Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double), const Stencil& stencil) {
     if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
     if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
     
-    m_size = (mesh_length - 1) * (mesh_length - 1);
-    m_matrix = gauss_override ? (new General_Matrix<T>(gen_coefficient_matrix<T>(mesh_length))) : (new Symmetric_Matrix<T>(gen_coefficient_matrix<T>(mesh_length)));
-    m_vec = gen_callback_vec<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    init_mesh(mesh_length, gauss_override, gen_padded_boundary<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left), stencil, start);
+}
+
+template <typename T>
+Matrix_Solver<T>::Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, Batch_Boundary upper, Batch_Boundary lower, Batch_Boundary right, Batch_Boundary left, const Stencil& stencil) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+    
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    init_mesh(mesh_length, gauss_override, gen_padded_boundary<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left), stencil, start);
+}
+
+template <typename T>
+template <typename Upper, typename Lower, typename Right, typename Left>
+Matrix_Solver<T>::Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, const bool& gauss_override, const Upper& upper, const Lower& lower, const Right& right, const Left& left, const Stencil& stencil) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+    
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    init_mesh(mesh_length, gauss_override, gen_padded_boundary<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left), stencil, start);
+}
+
+template <typename T>
+Matrix_Solver<T>::Matrix_Solver(const double& lower_bound, const double& upper_bound, const int& mesh_length, double (*upper)(double, double, double), double (*lower)(double, double, double), double (*right)(double, double, double), double (*left)(double, double, double), double (*front)(double, double, double), double (*back)(double, double, double)) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    m_size = (mesh_length - 1) * (mesh_length - 1) * (mesh_length - 1);
+    m_matrix = nullptr;
+    m_owns_matrix = false;
+    m_vec = gen_callback_vec_3d<T>(lower_bound, upper_bound, mesh_length, upper, lower, right, left, front, back);
+    m_mesh_length = 0;
+    m_stencil = five_point;
+    m_operator = new Stencil_Operator_3D<T>(mesh_length);
+    m_owns_operator = true;
     m_method = nullptr;
+    m_fixed_kernel = get_fixed_mesh_kernel<T>(nullptr, 0);
+    m_stats_enabled = solve_stats_default();
+    m_stats = empty_solve_stats();
+    m_stats.assembly_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+template <typename T>
+Matrix_Solver<T>::~Matrix_Solver() {
+    if (m_method != nullptr && !m_shared_factor) delete m_method;
+    if (m_owns_matrix && m_matrix != nullptr) delete m_matrix;
+    if (m_owns_operator && m_operator != nullptr) delete m_operator;
+}
+
+template <typename T>
+void Matrix_Solver<T>::factorize() {
+    factorize(nullptr);
+
+    return;
+}
+
+template <typename T>
+Factor_Kind Matrix_Solver<T>::get_factor_kind() const {
+    if (m_operator != nullptr || m_matrix->get_status() == row_reduced) { return no_factor; }
+
+    // Small mesh systems use the fixed-size banded Cholesky solver
+    if (m_matrix->get_status() == symmetric && m_mesh_length > 0 && m_mesh_length <= FIXED_MESH_LIMIT) { return fixed_mesh_factor; }
+
+    return (m_matrix->get_status() == symmetric) ? cholesky_factor : gaussian_factor;
+}
+
+template <typename T>
+Solver_Strategy<T>* Matrix_Solver<T>::create_method(const Factor_Kind& kind) const {
+    if (kind == fixed_mesh_factor) { return make_fixed_mesh_solver<T>(m_mesh_length); }
+    if (kind == cholesky_factor) { return new Cholesky_Solver<T>(); }
+
+    return new Gaussian_Solver<T>();
+}
+
+template <typename T>
+std::shared_ptr<Cached_Factor<T> > Matrix_Solver<T>::build_shared_factor(const Factor_Kind& kind, Solve_Control* control, size_t& bytes) const {
+    std::shared_ptr<Cached_Factor<T> > factor = std::make_shared<Cached_Factor<T> >();
+    const Base_Matrix<T>* matrix = m_matrix;
+    bytes = 0;
+
+    // The factorization may outlive this solver and its matrix
+    if (kind == gaussian_factor) {
+        factor->matrix.reset(new General_Matrix<T>(*m_matrix));
+        matrix = factor->matrix.get();
+        bytes += size_t(m_size) * size_t(m_size) * sizeof(T);
+    }
+
+    factor->method.reset(create_method(kind));
+    factor->method->set_control(control);
+    factor->method->factorize(*matrix);
+    factor->method->set_control(nullptr);
+    bytes += factor->method->get_factor_count() * sizeof(T);
+
+    return factor;
+}
+
+template <typename T>
+void Matrix_Solver<T>::factorize(Solve_Control* control) {
+    if (m_method != nullptr) { return; }
+
+    if (!get_stats_enabled()) {
+        select_method(control);
+        m_fixed_kernel = get_fixed_mesh_kernel<T>(m_method, m_mesh_length);
+        return;
+    }
+
+    Allocation_Scope allocations;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    select_method(control);
+    m_fixed_kernel = get_fixed_mesh_kernel<T>(m_method, m_mesh_length);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    m_stats.factor_seconds = seconds;
+    add_allocations(allocations.get_stats());
+    if (m_method != nullptr) {
+        m_stats.factor_bytes = m_method->get_factor_count() * sizeof(T);
+        m_stats.factor_flops = m_method->get_factor_flops();
+        m_stats.factor_shared = bool(m_shared_factor);
+    }
+
+    return;
+}
+
+template <typename T>
+void Matrix_Solver<T>::select_method(Solve_Control* control) {
+
+    // Matrix-free operators are solved iteratively
+    if (m_operator != nullptr) {
+        Conjugate_Gradient_Solver<T>* iterative = new Conjugate_Gradient_Solver<T>();
+        iterative->set_control(control);
+        iterative->factorize(*m_operator);
+        m_method = iterative;
+        return;
+    }
+
+    // Already row reduced (nothing to factor)
+    if (m_matrix->get_status() == row_reduced) { return; }
+
+    Factor_Kind kind = get_factor_kind();
+
+    // Mesh factorizations are shared with every other solver of the same mesh
+    if (m_mesh_length > 0) {
+        Factor_Key key = { int(m_stencil), m_mesh_length, numeric_limits<T>::digits, int(kind) };
+        m_shared_factor = factor_cache().get<Cached_Factor<T> >(key, [this, kind, control](size_t& bytes) {
+            return build_shared_factor(kind, control, bytes);
+        });
+        m_method = m_shared_factor->method.get();
+        return;
+    }
+
+    m_method = create_method(kind);
+
+    // A factorization cut short (cancelled or failed) is not kept
+    m_method->set_control(control);
+    try {
+        m_method->factorize(*m_matrix);
+    }
+    catch (...) {
+        delete m_method;
+        m_method = nullptr;
+        throw;
+    }
+
+    return;
+}
+
+template <typename T>
+void Matrix_Solver<T>::save_factor(const string& file_name) {
+    Factor_Kind kind = get_factor_kind();
+    if (kind == no_factor) { throw runtime_error("Error: Only factored matrices can be checkpointed."); }
+
+    factorize();
+
+    Factor_Header header;
+    memset(&header, 0, sizeof(header));
+    header.kind = uint32_t(kind);
+    header.scalar_size = uint32_t(sizeof(T));
+    header.scalar_digits = uint32_t(numeric_limits<T>::digits);
+    header.size = m_size;
+    header.mesh_length = m_mesh_length;
+    header.count = m_method->get_factor_count();
+    if (header.count > uint64_t(numeric_limits<int>::max())) { throw runtime_error("Error: Factor is too large to checkpoint."); }
+
+    Vector<T> factor(int(header.count), 0);
+    m_method->export_factor(factor.get_ptr());
+    header.matrix_checksum = matrix_checksum(*m_matrix);
+    header.checksum = checksum_values(FNV_OFFSET_BASIS, factor.get_ptr(), size_t(header.count));
+
+    write_factor_file(file_name, header, factor.get_ptr());
+
+    return;
+}
+
+template <typename T>
+void Matrix_Solver<T>::load_factor(const string& file_name) {
+    Factor_Kind kind = get_factor_kind();
+    if (kind == no_factor) { throw runtime_error("Error: Only factored matrices can be checkpointed."); }
+
+    std::unique_ptr<Allocation_Scope> allocations(get_stats_enabled() ? new Allocation_Scope() : nullptr);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Factor_File file(file_name);
+    const Factor_Header& header = file.get_header();
+    if (header.kind != uint32_t(kind) || header.scalar_size != sizeof(T) || header.scalar_digits != uint32_t(numeric_limits<T>::digits)
+        || header.size != m_size || header.mesh_length != m_mesh_length) {
+        throw runtime_error("Error: Factor checkpoint " + file_name + " was saved for a different solver, precision or mesh.");
+    }
+    if (header.matrix_checksum != matrix_checksum(*m_matrix)) {
+        throw runtime_error("Error: Factor checkpoint " + file_name + " was saved for a different matrix.");
+    }
+
+    const T* factor = file.get_values<T>();
+    size_t count = size_t(header.count);
+    if (header.checksum != checksum_values(FNV_OFFSET_BASIS, factor, count)) {
+        throw runtime_error("Error: Factor checkpoint " + file_name + " is damaged (checksum mismatch).");
+    }
+
+    Solver_Strategy<T>* method = create_method(kind);
+    try {
+        method->import_factor(*m_matrix, factor, count);
+    }
+    catch (...) {
+        delete method;
+        throw;
+    }
+
+    if (m_method != nullptr && !m_shared_factor) { delete m_method; }
+    m_shared_factor.reset();
+    m_method = method;
+    m_fixed_kernel = get_fixed_mesh_kernel<T>(m_method, m_mesh_length);
+
+    if (get_stats_enabled()) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_stats.factor_seconds = seconds;
+        m_stats.factor_bytes = count * sizeof(T);
+        m_stats.factor_flops = 0;
+        m_stats.factor_shared = false;
+        if (allocations) { add_allocations(allocations->get_stats()); }
+    }
+
+    return;
+}
+
+template <typename T>
+Solve_Stats Matrix_Solver<T>::get_stats() const {
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    Solve_Stats stats = m_stats;
+
+    // Symmetric matrices store their lower triangle only
+    if (m_matrix != nullptr) {
+        size_t size = size_t(m_size);
+        stats.matrix_bytes = ((m_matrix->get_status() == symmetric) ? size * (size + 1) / 2 : size * size) * sizeof(T);
+    }
+
+    return stats;
+}
+
+template <typename T>
+void Matrix_Solver<T>::reset_stats() {
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    m_stats.solve_seconds = 0;
+    m_stats.solves = 0;
+    m_stats.solve_flops = 0;
+    m_stats.iterations = 0;
+    m_stats.residual = 0;
+    m_stats.allocations = 0;
+    m_stats.allocated_bytes = 0;
+    m_stats.peak_bytes = 0;
+
+    return;
 }
 
 template <typename T>
 Vector<T> Matrix_Solver<T>::solve() {
-    Vector<T> result;
+    return solve(m_vec);
+}
 
+template <typename T>
+Vector<T> Matrix_Solver<T>::solve(const Vector<T>& rhs) {
     // Ensure size constraints are not violated
-    if (m_size != m_vec.get_size()) { throw domain_error("Solving strategies must be performed on a dimensionally consistent matrix/vector pair."); }
+    if (m_size != rhs.get_size()) { throw domain_error("Solving strategies must be performed on a dimensionally consistent matrix/vector pair."); }
 
     // If already row reduced ...
-    if (m_matrix->get_status() == row_reduced) {
-        result = m_matrix->back_sub(m_matrix->get_elements(), m_vec);
-    } 
-    // Perform Cholesky decomposition
-    else if (m_matrix->get_status() == symmetric) {
-        m_method = new Cholesky_Solver<T>();
-        result = m_method->solve(*m_matrix, m_vec);
-        delete m_method;
+    if (m_operator == nullptr && m_matrix->get_status() == row_reduced) {
+        return m_matrix->back_sub(m_matrix->get_elements(), rhs);
     }
-    // Perform Gaussian elimination
-    else {
-        m_method = new Gaussian_Solver<T>();
-        result = m_method->solve(*m_matrix, m_vec);
-        delete m_method;
+
+    factorize();
+
+    return run_substitution(rhs);
+}
+
+template <typename T>
+void Matrix_Solver<T>::solve(const T* rhs, T* solution) {
+    factorize();
+
+    if (m_fixed_kernel.solver != nullptr && !get_stats_enabled()) {
+        m_fixed_kernel.solve(m_fixed_kernel.solver, rhs, solution);
+        return;
+    }
+
+    Vector<T> vec(m_size, 0);
+    copy(rhs, rhs + m_size, vec.get_ptr());
+    Vector<T> result = solve(vec);
+    copy(result.get_ptr(), result.get_ptr() + m_size, solution);
+
+    return;
+}
+
+template <typename T>
+Vector<T> Matrix_Solver<T>::run_substitution(const Vector<T>& rhs) {
+    if (!get_stats_enabled()) { return m_method->substitute(rhs); }
+
+    Allocation_Scope allocations;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Vector<T> solution = m_method->substitute(rhs);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    Allocation_Stats allocated = allocations.get_stats();
+
+    // Relative residual of the solution, accumulated in long double
+    Vector<T> product = (m_operator != nullptr) ? (*m_operator) * solution : (*m_matrix) * solution;
+    long double residual_squared = 0;
+    long double rhs_squared = 0;
+    for (int i = 0; i < m_size; i++) {
+        long double difference = (long double)rhs[i] - (long double)product[i];
+        residual_squared += difference * difference;
+        rhs_squared += (long double)rhs[i] * (long double)rhs[i];
+    }
+
+    std::lock_guard<std::mutex> lock(m_stats_mutex);
+    m_stats.solve_seconds += seconds;
+    m_stats.solves++;
+    m_stats.solve_flops += m_method->get_substitute_flops();
+    m_stats.iterations = m_method->get_iterations();
+    m_stats.residual = (rhs_squared == 0) ? 0.0 : double(sqrt(residual_squared / rhs_squared));
+    add_allocations(allocated);
+
+    return solution;
+}
+
+template <typename T>
+void Matrix_Solver<T>::add_allocations(const Allocation_Stats& allocated) {
+    m_stats.allocations += allocated.allocations;
+    m_stats.allocated_bytes += allocated.allocated_bytes;
+    m_stats.peak_bytes = max(m_stats.peak_bytes, allocated.peak_bytes);
+
+    return;
+}
+
+template <typename T>
+Vector<Vector<T> > Matrix_Solver<T>::solve(const Vector<Vector<T> >& rhs_columns) {
+    for (int i = 0; i < rhs_columns.get_size(); i++) {
+        if (m_size != rhs_columns[i].get_size()) { throw domain_error("Solving strategies must be performed on a dimensionally consistent matrix/vector pair."); }
     }
 
-    return result;
-}
\ No newline at end of file
+    Vector<Vector<T> > results(rhs_columns);
+
+    // Already row reduced (no strategy to batch through)
+    if (m_operator == nullptr && m_matrix->get_status() == row_reduced) {
+        default_scheduler().parallel_for(0, rhs_columns.get_size(), [&](int i) {
+            results[i] = solve(rhs_columns[i]);
+        }, 1);
+        return results;
+    }
+
+    factorize();
+    bool measure = get_stats_enabled();
+    std::unique_ptr<Allocation_Scope> allocations(measure ? new Allocation_Scope() : nullptr);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    // Pack SIMD_LANES right hand sides per block, element-major (AoSoA); the last block is padded with zeros
+    int num_blocks = (rhs_columns.get_size() + SIMD_LANES - 1) / SIMD_LANES;
+    default_scheduler().parallel_for(0, num_blocks, [&](int b) {
+        Vector<T> block(m_size * SIMD_LANES, 0);
+        T* data = block.get_ptr();
+        int first = b * SIMD_LANES;
+        int lanes = min(SIMD_LANES, rhs_columns.get_size() - first);
+
+        for (int l = 0; l < lanes; l++) {
+            const T* rhs = rhs_columns[first + l].get_ptr();
+            for (int i = 0; i < m_size; i++) { data[i * SIMD_LANES + l] = rhs[i]; }
+        }
+
+        m_method->substitute_interleaved(data, m_size);
+
+        for (int l = 0; l < lanes; l++) {
+            T* solution = results[first + l].get_ptr();
+            for (int i = 0; i < m_size; i++) { solution[i] = data[i * SIMD_LANES + l]; }
+        }
+    }, 1);
+
+    if (measure) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_stats.solve_seconds += seconds;
+        m_stats.solves += rhs_columns.get_size();
+        m_stats.solve_flops += rhs_columns.get_size() * m_method->get_substitute_flops();
+        add_allocations(allocations->get_stats());
+    }
+
+    return results;
+}
+
+template <typename T>
+Solve_Handle<T> Matrix_Solver<T>::solve_async(const Vector<T>& rhs) {
+    if (m_size != rhs.get_size()) { throw domain_error("Solving strategies must be performed on a dimensionally consistent matrix/vector pair."); }
+
+    std::shared_ptr<Solve_Control> control = std::make_shared<Solve_Control>();
+
+    // Runs on its own thread so the scheduler's workers stay free for the solve's parallel loops
+    std::future<Vector<T> > result = std::async(std::launch::async, [this, rhs, control]() {
+        if (m_operator == nullptr && m_matrix->get_status() == row_reduced) {
+            control->check();
+            return m_matrix->back_sub(m_matrix->get_elements(), rhs);
+        }
+
+        factorize(control.get());
+
+        // The substitution is watched too (it is where iterative strategies do their work); a shared
+        // factorization is used by other solvers and is left unwatched
+        Solver_Strategy<T>* watched = m_shared_factor ? nullptr : m_method;
+        if (watched != nullptr) { watched->set_control(control.get()); }
+        try {
+            Vector<T> solution = run_substitution(rhs);
+            if (watched != nullptr) { watched->set_control(nullptr); }
+            control->set_progress(1);
+            return solution;
+        }
+        catch (...) {
+            if (watched != nullptr) { watched->set_control(nullptr); }
+            throw;
+        }
+    });
+
+    return Solve_Handle<T>(control, std::move(result));
+}
@@ -0,0 +1,98 @@
+/*! \file
+ *  Chunked text output and the binary (.npy) solution writer.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SOLUTION_WRITER_H
+#define SOLUTION_WRITER_H
+#include "libraries.h"
+#include "vector.h"
+#include "grid_2d.h"
+#include "task_scheduler.h"
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*! Lines of text in one chunk formatted by a single task (see write_chunked_text) */
+const int TEXT_CHUNK_LINES = 16384;
+
+/*! Appends a number to `text` formatted like `ostream << value` (6 significant digits, %g) */
+inline void append_number(string& text, const double value);
+
+/*! Appends a number to `text` formatted like `ostream << value` (6 significant digits, %Lg) */
+inline void append_number(string& text, const long double value);
+
+/*! Write a text file whose contents are split into chunks that are formatted concurrently
+*
+*  Chunks are formatted a wave at a time (4 per scheduler thread), each into its own buffer on the
+*  default scheduler. Once a wave is formatted the file offset of every chunk follows from the
+*  sizes before it, and the chunks are written with pwrite at those offsets, also concurrently.
+*  The file therefore holds the chunks in order, exactly as if they were formatted one after
+*  another, while only one wave of text is held in memory.
+*
+*  \param file_name the file to create (truncated if it exists)
+*  \param chunk_count the number of chunks
+*  \param format_chunk called as format_chunk(chunk, text) to append chunk number `chunk` to `text`
+*
+*  \pre format_chunk is safe to call concurrently for different chunks
+*  \post the chunks are written to file_name in order
+*  \throws runtime_error thrown if the file cannot be written
+*  \relates Matrix_Solver
+*/
+template <typename Format>
+void write_chunked_text(const string& file_name, const int& chunk_count, const Format& format_chunk);
+
+/*! NumPy dtype description and name of a floating point type (see write_npy) */
+template <typename T>
+struct Npy_Type;
+
+template <>
+struct Npy_Type<float> {
+    static const char* descr() { return "f4"; }
+    static const char* name() { return "float"; }
+};
+
+template <>
+struct Npy_Type<double> {
+    static const char* descr() { return "f8"; }
+    static const char* name() { return "double"; }
+};
+
+/*! numpy reads x86 extended precision as float128 (16 bytes including padding) */
+template <>
+struct Npy_Type<long double> {
+    static const char* descr() { return sizeof(long double) == 16 ? "f16" : (sizeof(long double) == 12 ? "f12" : "f8"); }
+    static const char* name() { return "long double"; }
+};
+
+/*! Write a solution as a NumPy .npy file (format version 1.0)
+*
+*  The array has shape (mesh_length - 1, mesh_length - 1): row j - 1 holds the interior points
+*  with y index j, x fastest, so numpy.load returns the solution laid out like the mesh. The header
+*  dictionary holds only the keys numpy requires; the mesh length, bounds and precision follow it
+*  as a Python comment, which numpy ignores when parsing the header:
+*
+*      {'descr': '<f8', 'fortran_order': False, 'shape': (9, 9), } # mesh_length: 10, ...
+*
+*  The values are written raw in native byte order (recorded in descr), one fwrite for the array.
+*
+*  \param lower_bound the lower bound of the mesh
+*  \param upper_bound the upper bound of the mesh
+*  \param mesh_length the length of the mesh
+*  \param result a Vector representing the solution vector x in Ax=b
+*  \param file_name the name of the file to be written to
+*
+*  \pre upper_bound > lower_bound
+*  \pre mesh_length > 1
+*  \pre result has one entry per interior mesh point
+*  \post the solution is written to file_name
+*  \throws domain_error thrown if result is not sized for the mesh
+*  \throws runtime_error thrown if the file cannot be written
+*  \relates Matrix_Solver
+*/
+template <typename T>
+void write_npy(const double& lower_bound, const double& upper_bound, const int& mesh_length, const Vector<T>& result, const string& file_name);
+
+#include "solution_writer.hpp"
+#endif
@@ -0,0 +1,107 @@
+/*! \file
+ *  Function definitions for the chunked text output and the binary solution writer.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline void append_number(string& text, const double value) {
+    char digits[32];
+    int length = snprintf(digits, sizeof(digits), "%g", value);
+    text.append(digits, size_t(length));
+
+    return;
+}
+
+inline void append_number(string& text, const long double value) {
+    char digits[48];
+    int length = snprintf(digits, sizeof(digits), "%Lg", value);
+    text.append(digits, size_t(length));
+
+    return;
+}
+
+template <typename Format>
+void write_chunked_text(const string& file_name, const int& chunk_count, const Format& format_chunk) {
+    int file = open(file_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (file < 0) { throw runtime_error("Error: Could not open " + file_name + " for writing."); }
+
+    Task_Scheduler& scheduler = default_scheduler();
+    int wave = 4 * scheduler.get_num_threads();
+    Vector<string> chunks(wave, string());
+    Vector<off_t> offsets(wave, 0);
+    off_t file_size = 0;
+
+    try {
+        for (int first = 0; first < chunk_count; first += wave) {
+            int count = min(wave, chunk_count - first);
+
+            scheduler.parallel_for(0, count, [&](int c) {
+                chunks[c].clear();
+                format_chunk(first + c, chunks[c]);
+            }, 1);
+
+            // Each chunk starts where the previous one ends
+            for (int c = 0; c < count; c++) {
+                offsets[c] = file_size;
+                file_size += off_t(chunks[c].size());
+            }
+
+            scheduler.parallel_for(0, count, [&](int c) {
+                const char* data = chunks[c].data();
+                size_t remaining = chunks[c].size();
+                off_t offset = offsets[c];
+                while (remaining > 0) {
+                    ssize_t written = pwrite(file, data, remaining, offset);
+                    if (written <= 0) { throw runtime_error("Error: Could not write " + file_name + "."); }
+                    data += written;
+                    remaining -= size_t(written);
+                    offset += written;
+                }
+            }, 1);
+        }
+    }
+    catch (...) {
+        close(file);
+        throw;
+    }
+
+    if (close(file) != 0) { throw runtime_error("Error: Could not write " + file_name + "."); }
+
+    return;
+}
+
+template <typename T>
+void write_npy(const double& lower_bound, const double& upper_bound, const int& mesh_length, const Vector<T>& result, const string& file_name) {
+    Grid_2D grid(lower_bound, upper_bound, mesh_length);
+    if (result.get_size() != grid.get_interior_count()) { throw domain_error("Error: Vector must have one entry per interior mesh point."); }
+
+    // Byte order of this machine, as numpy spells it
+    const int probe = 1;
+    const char order = (*reinterpret_cast<const char*>(&probe) == 1) ? '<' : '>';
+
+    char dictionary[256];
+    int length = snprintf(dictionary, sizeof(dictionary),
+                          "{'descr': '%c%s', 'fortran_order': False, 'shape': (%d, %d), } # mesh_length: %d, lower_bound: %.17g, upper_bound: %.17g, precision: %s",
+                          order, Npy_Type<T>::descr(), grid.get_row_length(), grid.get_row_length(), mesh_length, lower_bound, upper_bound, Npy_Type<T>::name());
+
+    // Magic, version 1.0, header length (little endian), then the header padded with spaces and
+    // ended by a newline so the data starts on a 64 byte boundary
+    string header("\x93NUMPY\x01\x00", 8);
+    int header_length = length + 1;
+    header_length += (64 - (10 + header_length) % 64) % 64;
+    header.push_back(char(header_length & 0xff));
+    header.push_back(char(header_length >> 8));
+    header.append(dictionary, size_t(length));
+    header.append(size_t(header_length - length - 1), ' ');
+    header.push_back('\n');
+
+    FILE* file = fopen(file_name.c_str(), "wb");
+    if (file == nullptr) { throw runtime_error("Error: Could not open " + file_name + " for writing."); }
+
+    size_t count = size_t(result.get_size());
+    bool written = fwrite(header.data(), 1, header.size(), file) == header.size()
+                && fwrite(result.get_ptr(), sizeof(T), count, file) == count;
+    if (fclose(file) != 0 || !written) { throw runtime_error("Error: Could not write " + file_name + "."); }
+
+    return;
+}
@@ -0,0 +1,70 @@
+/*! \file
+ *  Solve_Control and Solve_Cancelled class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SOLVE_CONTROL_H
+#define SOLVE_CONTROL_H
+#include "libraries.h"
+#include <atomic>
+
+/*! Exception thrown out of a solve that was cancelled through its `Solve_Control` */
+class Solve_Cancelled : public runtime_error {
+    public:
+        /*! Constructs the exception with the standard message */
+        Solve_Cancelled() : runtime_error("Error: Solve was cancelled.") {}
+};
+
+/*! State shared between a running solve and the threads watching it.
+ *
+ *  The solver strategies poll `check` between columns, tiles and iterations (cooperative
+ *  cancellation) and publish how far along they are. Every member may be used from any thread.
+ */
+class Solve_Control {
+    private:
+        std::atomic<bool> m_cancelled;
+        std::atomic<double> m_progress;
+        std::atomic<double> m_residual;
+
+    public:
+        /*! Constructs a control for a solve that has not started */
+        Solve_Control() : m_cancelled(false), m_progress(0), m_residual(-1) {}
+
+        /*! Requests the solve to stop at its next check
+          *
+          * \pre none
+          * \post the next `check` throws Solve_Cancelled
+        */
+        void cancel() { m_cancelled.store(true); }
+
+        /*! Gets whether cancellation has been requested */
+        bool is_cancelled() const { return m_cancelled.load(); }
+
+        /*! Cancellation point for the solvers
+          *
+          * \pre none
+          * \post none
+          * \throws Solve_Cancelled thrown if cancellation has been requested
+        */
+        void check() const;
+
+        /*! Publishes the fraction of the solve that is done
+          *
+          * \pre 0 <= fraction <= 1
+          * \post `get_progress` returns `fraction`
+        */
+        void set_progress(const double& fraction) { m_progress.store(fraction); }
+
+        /*! Gets the fraction of the solve that is done (columns or tiles factored, or residual reduction reached) */
+        double get_progress() const { return m_progress.load(); }
+
+        /*! Publishes the current relative residual of an iterative solve */
+        void set_residual(const double& residual) { m_residual.store(residual); }
+
+        /*! Gets the current relative residual of an iterative solve (-1 for direct solves) */
+        double get_residual() const { return m_residual.load(); }
+};
+
+#include "solve_control.hpp"
+#endif
@@ -0,0 +1,11 @@
+/*! \file
+ *  Function definitions for the `Solve_Control` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline void Solve_Control::check() const {
+    if (m_cancelled.load()) { throw Solve_Cancelled(); }
+
+    return;
+}
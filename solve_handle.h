@@ -0,0 +1,80 @@
+/*! \file
+ *  Solve_Handle class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SOLVE_HANDLE_H
+#define SOLVE_HANDLE_H
+#include "vector.h"
+#include "solve_control.h"
+#include <chrono>
+#include <future>
+#include <memory>
+
+/*! Future-like handle of a solve running in the background (see `Matrix_Solver::solve_async`).
+ *
+ *  Dropping a handle whose solve is still running cancels the solve and waits for it to stop,
+ *  so abandoned requests do not keep burning cores.
+ */
+template <class T>
+class Solve_Handle {
+    private:
+        std::shared_ptr<Solve_Control> m_control;
+        std::future<Vector<T> > m_result;
+
+    public:
+        /*! Constructs a handle from the control and the result of a started solve */
+        Solve_Handle(const std::shared_ptr<Solve_Control>& control, std::future<Vector<T> >&& result);
+
+        /*! Move constructor */
+        Solve_Handle(Solve_Handle&& other) = default;
+
+        /*! Move assignment, cancels and waits for this handle's solve first (like the destructor)
+          *
+          * \post this handle holds other's solve and other holds none
+        */
+        Solve_Handle& operator=(Solve_Handle&& other);
+
+        /*! Destructor, cancels and waits for a solve that has not finished */
+        ~Solve_Handle();
+
+        /*! Waits for the solve and gets its solution
+          *
+          * \return the solution vector
+          * 
+          * \pre get has not been called before on this handle
+          * \post the handle no longer holds a result
+          * \throws Solve_Cancelled thrown if the solve was cancelled before finishing
+          * \throws rethrows any other exception thrown by the solve
+        */
+        Vector<T> get();
+
+        /*! Waits until the solve has finished */
+        void wait() const { m_result.wait(); }
+
+        /*! Waits until the solve has finished or `seconds` have passed
+          *
+          * \return true if the solve has finished
+        */
+        bool wait_for(const double& seconds) const;
+
+        /*! Gets whether the solve has finished (without waiting) */
+        bool is_ready() const { return wait_for(0); }
+
+        /*! Requests the solve to stop at its next cancellation point
+          *
+          * \pre none
+          * \post `get` throws Solve_Cancelled unless the solve already finished
+        */
+        void cancel() { m_control->cancel(); }
+
+        /*! Gets the fraction of the solve that is done (0 to 1) */
+        double get_progress() const { return m_control->get_progress(); }
+
+        /*! Gets the current relative residual of an iterative solve (-1 for direct solves) */
+        double get_residual() const { return m_control->get_residual(); }
+};
+
+#include "solve_handle.hpp"
+#endif
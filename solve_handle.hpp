@@ -0,0 +1,46 @@
+/*! \file
+ *  Function definitions for the `Solve_Handle` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Solve_Handle<T>::Solve_Handle(const std::shared_ptr<Solve_Control>& control, std::future<Vector<T> >&& result)
+    : m_control(control), m_result(std::move(result)) {}
+
+template <typename T>
+Solve_Handle<T>::~Solve_Handle() {
+    if (m_result.valid()) {
+        m_control->cancel();
+        m_result.wait();
+    }
+}
+
+template <typename T>
+Solve_Handle<T>& Solve_Handle<T>::operator=(Solve_Handle<T>&& other) {
+    if (this == &other) { return *this; }
+
+    // The solve being replaced is abandoned, so it is cancelled rather than run to completion
+    if (m_result.valid()) {
+        m_control->cancel();
+        m_result.wait();
+    }
+    m_control = std::move(other.m_control);
+    m_result = std::move(other.m_result);
+
+    return *this;
+}
+
+template <typename T>
+Vector<T> Solve_Handle<T>::get() {
+    if (!m_result.valid()) { throw runtime_error("Error: Solve handle holds no result."); }
+
+    return m_result.get();
+}
+
+template <typename T>
+bool Solve_Handle<T>::wait_for(const double& seconds) const {
+    if (!m_result.valid()) { return true; }
+
+    return m_result.wait_for(std::chrono::duration<double>(seconds)) == std::future_status::ready;
+}
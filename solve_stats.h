@@ -0,0 +1,50 @@
+/*! \file
+ *  Solve_Stats structure definition.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SOLVE_STATS_H
+#define SOLVE_STATS_H
+#include "libraries.h"
+#include "allocation_counter.h"
+#include <cstdlib>
+
+/*! Environment variable that turns statistics on for every new `Matrix_Solver` (any value but "0") */
+const char* const SOLVE_STATS_VARIABLE = "FDS_SOLVE_STATS";
+
+/*! What a `Matrix_Solver` measured about its system and solves (see Matrix_Solver::get_stats)
+ *
+ *  Times are wall seconds. Flop counts are estimates from the size of the system (and the
+ *  iteration count of iterative strategies), not hardware counters.
+ */
+struct Solve_Stats {
+    double assembly_seconds;    //!< generating the system (mesh constructors only)
+    double factor_seconds;      //!< factoring, waiting for a shared factorization, or loading a checkpoint
+    double solve_seconds;       //!< substitutions, summed over every solve
+    int solves;                 //!< right hand sides solved
+    size_t matrix_bytes;        //!< the stored coefficient matrix (0 for operators)
+    size_t factor_bytes;        //!< the stored factorization
+    double factor_flops;        //!< estimated floating point operations of the factorization
+    double solve_flops;         //!< estimated floating point operations of the substitutions, summed
+    int iterations;             //!< iterations of the last single solve (0 for direct strategies)
+    double residual;            //!< relative residual |b - A x| / |b| of the last single solve
+    bool factor_shared;         //!< the factorization is shared through the factor cache
+    long long allocations;      //!< Vector blocks allocated by the factorization and solves
+    long long allocated_bytes;  //!< bytes of those blocks
+    long long peak_bytes;       //!< largest rise of the live Vector storage during one of them (see Allocation_Scope)
+};
+
+/*! Gets a `Solve_Stats` with every measurement zero */
+inline Solve_Stats empty_solve_stats() {
+    Solve_Stats stats = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, 0 };
+    return stats;
+}
+
+/*! Whether new solvers collect statistics: off unless SOLVE_STATS_VARIABLE is set (read once) */
+inline bool solve_stats_default() {
+    static const bool enabled = (getenv(SOLVE_STATS_VARIABLE) != nullptr && string(getenv(SOLVE_STATS_VARIABLE)) != "0");
+    return enabled;
+}
+
+#endif
@@ -7,16 +7,87 @@
 #ifndef SOLVER_STRATEGY_H
 #define SOLVER_STRATEGY_H
 #include "base_matrix.h"
+#include "solve_control.h"
+
+/*! Number of right hand sides interleaved per block by batch substitutions (8 doubles fill one
+ *  AVX-512 register or two AVX2 registers) */
+const int SIMD_LANES = 8;
 
 /*! Generic solver class */
 template <class T>
 class Solver_Strategy { 
+    protected:
+        // Cancellation and progress of the running solve (nullptr when nobody is watching)
+        Solve_Control* m_control;
+
     public:
+        /*! Constructs a strategy that is not watched by any `Solve_Control` */
+        Solver_Strategy() : m_control(nullptr) {}
+
+        /*! Attaches `control` to the factorization and substitution loops (nullptr detaches)
+          *
+          * \pre `control` outlives its use by this strategy
+          * \post the loops poll `control` for cancellation and publish their progress to it
+        */
+        void set_control(Solve_Control* control) { m_control = control; }
+
         /*! Pure virtual function for specific solver methods to implement */
         virtual Vector<T> solve(const Base_Matrix<T>& matrix, Vector<T> vec) = 0;
 
+        /*! Pure virtual function to factor `matrix` once so that it can be reused by `substitute` */
+        virtual void factorize(const Base_Matrix<T>& matrix) = 0;
+
+        /*! Pure virtual function to solve against the stored factorization with right hand side `vec` */
+        virtual Vector<T> substitute(Vector<T> vec) const = 0;
+
+        /*! Solves against the stored factorization for SIMD_LANES right hand sides stored interleaved
+          * (element i of right hand side l at block[i * SIMD_LANES + l]), in place. Strategies with
+          * lane-parallel substitutions override this; the default substitutes lane by lane.
+          *
+          * \pre `factorize` has been called and `block` holds size * SIMD_LANES elements
+          * \post `block` holds the interleaved solutions
+        */
+        virtual void substitute_interleaved(T* block, const int& size) const {
+            Vector<T> lane(size, 0);
+            for (int l = 0; l < SIMD_LANES; l++) {
+                for (int i = 0; i < size; i++) { lane[i] = block[i * SIMD_LANES + l]; }
+                Vector<T> solution = substitute(lane);
+                for (int i = 0; i < size; i++) { block[i * SIMD_LANES + l] = solution[i]; }
+            }
+        }
+
+        /*! Gets the estimated floating point operations of `factorize` (0 if unknown) */
+        virtual double get_factor_flops() const { return 0; }
+
+        /*! Gets the estimated floating point operations of one `substitute` (0 if unknown) */
+        virtual double get_substitute_flops() const { return 0; }
+
+        /*! Gets the iterations taken by the last `substitute` (0 for direct strategies) */
+        virtual int get_iterations() const { return 0; }
+
+        /*! Gets the number of values `export_factor` writes (0 if the strategy cannot be checkpointed) */
+        virtual size_t get_factor_count() const { return 0; }
+
+        /*! Copies the stored factorization into `factor` as raw values, for checkpoints (see
+          * Matrix_Solver::save_factor). Strategies that can be checkpointed override this.
+          *
+          * \pre `factorize` has been called and `factor` holds get_factor_count() elements
+          * \post `factor` holds the factorization
+          * \throws runtime_error thrown if the strategy cannot be checkpointed
+        */
+        virtual void export_factor(T*) const { throw runtime_error("Error: Solving strategy does not support factor checkpoints."); }
+
+        /*! Restores the factorization of `matrix` from values written by `export_factor`
+          *
+          * \pre `factor` holds `count` values exported from a factorization of `matrix`
+          * \post the strategy is factored as if `factorize(matrix)` had been called
+          * \throws domain_error thrown if `count` does not fit `matrix`
+          * \throws runtime_error thrown if the strategy cannot be checkpointed
+        */
+        virtual void import_factor(const Base_Matrix<T>&, const T*, const size_t&) { throw runtime_error("Error: Solving strategy does not support factor checkpoints."); }
+
         /*! Virtual destructor */
         virtual ~Solver_Strategy() {}
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,119 @@
+/*! \file
+ *  Sparse_Matrix class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+#include "linear_operator.h"
+#include "task_scheduler.h"
+#include <memory>
+
+/*! Square matrix in compressed sparse row (CSR) form
+ *
+ *  Row i holds the entries m_values[m_row_start[i] .. m_row_start[i + 1]), in increasing column
+ *  order, with their columns in m_columns. Only stored entries are visited, so a product costs
+ *  O(nonzeros) instead of O(n^2). A symmetric matrix stores both triangles (products need no
+ *  transposed pass) and remembers that it is symmetric so it can be written back as a triangle.
+ *
+ *  The matrix is a `Linear_Operator`, so it is solved iteratively (see Matrix_Solver).
+ */
+template <class T>
+class Sparse_Matrix : public Linear_Operator<T> {
+    private:
+        int m_size;
+        bool m_symmetric;
+        Vector<int> m_row_start;
+        Vector<int> m_columns;
+        Vector<T> m_values;
+
+    public:
+        /*! Constructs an empty (0 x 0) matrix */
+        Sparse_Matrix();
+
+        /*! Constructs a matrix from its compressed rows
+          *
+          * \param size the number of rows (and columns)
+          * \param row_start where each row starts in `columns` and `values`, followed by the entry count
+          * \param columns the column of every entry
+          * \param values the value of every entry
+          * \param symmetric whether the matrix is symmetric (both triangles are still stored)
+          *
+          * \pre row_start.get_size() == size + 1, row_start[0] == 0 and row_start is non-decreasing
+          * \pre the columns of each row are increasing and within [0, size)
+          * \post the matrix takes the given rows
+          * \throws domain_error thrown if the rows are not well formed
+        */
+        Sparse_Matrix(const int& size, Vector<int> row_start, Vector<int> columns, Vector<T> values, const bool& symmetric = false);
+
+        /*! Constructs the sparse form of a dense matrix (zeros are not stored)
+          *
+          * \param source the matrix to compress
+          *
+          * \pre none
+          * \post the matrix holds the non-zero entries of `source`, and is symmetric if `source` is
+        */
+        explicit Sparse_Matrix(const Base_Matrix<T>& source);
+
+        /*! Multiplies the matrix with `vec` (rows are swept concurrently on the default scheduler)
+          *
+          * \pre vec.get_size() == get_size()
+          * \post none
+          * \return matrix * vec
+          * \throws domain_error thrown if the sizes differ
+        */
+        virtual Vector<T> operator*(const Vector<T>& vec) const;
+
+        /*! Multiplies the matrix with `lanes` interleaved vectors, reading every entry once for all lanes
+          * (see Linear_Operator::apply_interleaved)
+        */
+        virtual void apply_interleaved(const T* in, T* out, const int& lanes) const;
+
+        /*! Gets the number of rows (and columns) */
+        virtual int get_size() const { return m_size; }
+
+        /*! Gets the estimated floating point operations of one product (2 per stored entry) */
+        virtual double get_apply_flops() const { return 2.0 * double(get_nonzero_count()); }
+
+        /*! Gets the number of stored entries (both triangles of a symmetric matrix) */
+        int get_nonzero_count() const { return m_row_start[m_size]; }
+
+        /*! Gets whether the matrix is symmetric */
+        bool is_symmetric() const { return m_symmetric; }
+
+        /*! Gets an element of the matrix (zero if it is not stored)
+          *
+          * \pre 0 <= row, col < get_size()
+          * \return the element in row `row` and column `col`
+          * \throws out_of_range thrown if pre-condition broken
+        */
+        T get_element(const int& row, const int& col) const;
+
+        /*! Gets where each row starts in get_columns() and get_values() (get_size() + 1 entries) */
+        const Vector<int>& get_row_start() const { return m_row_start; }
+
+        /*! Gets the column of every stored entry */
+        const Vector<int>& get_columns() const { return m_columns; }
+
+        /*! Gets every stored entry */
+        const Vector<T>& get_values() const { return m_values; }
+};
+
+/*! Builds a sparse matrix from (row, column, value) triplets
+ *
+ *  \param size the number of rows (and columns)
+ *  \param rows the row of every triplet
+ *  \param columns the column of every triplet
+ *  \param values the value of every triplet
+ *  \param symmetric whether the triplets are one triangle of a symmetric matrix (they are mirrored)
+ *
+ *  \pre rows, columns and values have the same size and every index is within [0, size)
+ *  \return the matrix; repeated entries are summed (in the order given)
+ *  \throws domain_error thrown if pre-condition broken
+ */
+template <typename T>
+Sparse_Matrix<T> make_sparse_matrix(const int& size, const Vector<int>& rows, const Vector<int>& columns, const Vector<T>& values, const bool& symmetric = false);
+
+#include "sparse_matrix.hpp"
+#endif
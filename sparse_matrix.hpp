@@ -0,0 +1,185 @@
+/*! \file
+ *  Function definitions for the `Sparse_Matrix` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix() : m_size(0), m_symmetric(false), m_row_start(1, 0), m_columns(0), m_values(0) {}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(const int& size, Vector<int> row_start, Vector<int> columns, Vector<T> values, const bool& symmetric)
+    : m_size(size), m_symmetric(symmetric), m_row_start(std::move(row_start)), m_columns(std::move(columns)), m_values(std::move(values)) {
+    if (m_size < 0 || m_row_start.get_size() != m_size + 1 || m_row_start[0] != 0 || m_row_start[m_size] != m_columns.get_size()
+        || m_columns.get_size() != m_values.get_size()) {
+        throw domain_error("Error: Sparse matrix rows are not well formed.");
+    }
+
+    const int* start = m_row_start.get_ptr();
+    const int* column = m_columns.get_ptr();
+    for (int i = 0; i < m_size; i++) {
+        if (start[i + 1] < start[i]) { throw domain_error("Error: Sparse matrix rows are not well formed."); }
+        for (int k = start[i]; k < start[i + 1]; k++) {
+            if (column[k] < 0 || column[k] >= m_size || (k > start[i] && column[k] <= column[k - 1])) {
+                throw domain_error("Error: Sparse matrix columns must be increasing and within the matrix.");
+            }
+        }
+    }
+}
+
+template <typename T>
+Sparse_Matrix<T>::Sparse_Matrix(const Base_Matrix<T>& source) : m_size(source.get_size()), m_symmetric(source.get_status() == symmetric), m_row_start(source.get_size() + 1, 0) {
+    int* start = m_row_start.get_ptr();
+    for (int i = 0; i < m_size; i++) {
+        start[i + 1] = start[i];
+        for (int j = 0; j < m_size; j++) {
+            if (source.get_element(i, j) != T(0)) { start[i + 1]++; }
+        }
+    }
+
+    m_columns = Vector<int>(start[m_size], 0);
+    m_values = Vector<T>(start[m_size], 0);
+    default_scheduler().parallel_for(0, m_size, [&](int i) {
+        int k = start[i];
+        for (int j = 0; j < m_size; j++) {
+            T value = source.get_element(i, j);
+            if (value != T(0)) {
+                m_columns.get_ptr()[k] = j;
+                m_values.get_ptr()[k] = value;
+                k++;
+            }
+        }
+    });
+}
+
+template <typename T>
+Vector<T> Sparse_Matrix<T>::operator*(const Vector<T>& vec) const {
+    if (m_size != vec.get_size()) { throw domain_error("Error: Square matrix to be multiplied by vector must have same number of rows"); }
+
+    Vector<T> result(m_size, 0);
+    const int* start = m_row_start.get_ptr();
+    const int* column = m_columns.get_ptr();
+    const T* value = m_values.get_ptr();
+    const T* in = vec.get_ptr();
+    T* out = result.get_ptr();
+
+    default_scheduler().parallel_for(0, m_size, [&](int i) {
+        T sum(0);
+        for (int k = start[i]; k < start[i + 1]; k++) { sum += value[k] * in[column[k]]; }
+        out[i] = sum;
+    });
+
+    return result;
+}
+
+template <typename T>
+void Sparse_Matrix<T>::apply_interleaved(const T* in, T* out, const int& lanes) const {
+    const int* start = m_row_start.get_ptr();
+    const int* column = m_columns.get_ptr();
+    const T* value = m_values.get_ptr();
+
+    default_scheduler().parallel_for(0, m_size, [&](int i) {
+        T* row = out + size_t(i) * size_t(lanes);
+        for (int l = 0; l < lanes; l++) { row[l] = T(0); }
+        for (int k = start[i]; k < start[i + 1]; k++) {
+            const T* x = in + size_t(column[k]) * size_t(lanes);
+            for (int l = 0; l < lanes; l++) { row[l] += value[k] * x[l]; }
+        }
+    });
+}
+
+template <typename T>
+T Sparse_Matrix<T>::get_element(const int& row, const int& col) const {
+    if (row < 0 || row >= m_size || col < 0 || col >= m_size) { throw out_of_range("Error: Attempt to access matrix member out of range."); }
+
+    const int* first = m_columns.get_ptr() + m_row_start[row];
+    const int* last = m_columns.get_ptr() + m_row_start[row + 1];
+    const int* found = lower_bound(first, last, col);
+    if (found == last || *found != col) { return T(0); }
+
+    return m_values[int(found - m_columns.get_ptr())];
+}
+
+template <typename T>
+Sparse_Matrix<T> make_sparse_matrix(const int& size, const Vector<int>& rows, const Vector<int>& columns, const Vector<T>& values, const bool& symmetric) {
+    int count = rows.get_size();
+    if (size < 0 || columns.get_size() != count || values.get_size() != count) { throw domain_error("Error: Every sparse matrix entry needs a row, a column and a value."); }
+
+    const int* row = rows.get_ptr();
+    const int* column = columns.get_ptr();
+    const T* value = values.get_ptr();
+
+    // Entries per row (mirrored entries of a symmetric matrix included)
+    Vector<int> row_start(size + 1, 0);
+    int* start = row_start.get_ptr();
+    for (int k = 0; k < count; k++) {
+        if (row[k] < 0 || row[k] >= size || column[k] < 0 || column[k] >= size) { throw domain_error("Error: Sparse matrix entry is outside the matrix."); }
+        start[row[k] + 1]++;
+        if (symmetric && row[k] != column[k]) { start[column[k] + 1]++; }
+    }
+    for (int i = 0; i < size; i++) { start[i + 1] += start[i]; }
+
+    // Scatter the entries into their rows
+    Vector<int> next(row_start);
+    Vector<int> scattered_columns(start[size], 0);
+    Vector<T> scattered_values(start[size], 0);
+    int* fill = next.get_ptr();
+    int* to_column = scattered_columns.get_ptr();
+    T* to_value = scattered_values.get_ptr();
+    for (int k = 0; k < count; k++) {
+        int at = fill[row[k]]++;
+        to_column[at] = column[k];
+        to_value[at] = value[k];
+        if (symmetric && row[k] != column[k]) {
+            at = fill[column[k]]++;
+            to_column[at] = row[k];
+            to_value[at] = value[k];
+        }
+    }
+
+    // Sort every row by column and sum repeated entries (rows are compacted in place)
+    Vector<int> kept(size + 1, 0);
+    int* length = kept.get_ptr();
+    default_scheduler().parallel_for(0, size, [&](int i) {
+        int first = start[i];
+        int last = start[i + 1];
+        if (!is_sorted(to_column + first, to_column + last)) {
+            std::unique_ptr<pair<int, T>[]> entries(new pair<int, T>[last - first]);
+            for (int k = first; k < last; k++) { entries[k - first] = make_pair(to_column[k], to_value[k]); }
+            stable_sort(entries.get(), entries.get() + (last - first), [](const pair<int, T>& a, const pair<int, T>& b) { return a.first < b.first; });
+            for (int k = first; k < last; k++) {
+                to_column[k] = entries[k - first].first;
+                to_value[k] = entries[k - first].second;
+            }
+        }
+
+        int out = first;
+        for (int k = first; k < last; k++) {
+            if (out > first && to_column[out - 1] == to_column[k]) {
+                to_value[out - 1] += to_value[k];
+            }
+            else {
+                to_column[out] = to_column[k];
+                to_value[out] = to_value[k];
+                out++;
+            }
+        }
+        length[i + 1] = out - first;
+    });
+
+    for (int i = 0; i < size; i++) { length[i + 1] += length[i]; }
+    if (length[size] == start[size]) {
+        return Sparse_Matrix<T>(size, std::move(row_start), std::move(scattered_columns), std::move(scattered_values), symmetric);
+    }
+
+    Vector<int> compact_columns(length[size], 0);
+    Vector<T> compact_values(length[size], 0);
+    default_scheduler().parallel_for(0, size, [&](int i) {
+        for (int k = 0; k < length[i + 1] - length[i]; k++) {
+            compact_columns.get_ptr()[length[i] + k] = to_column[start[i] + k];
+            compact_values.get_ptr()[length[i] + k] = to_value[start[i] + k];
+        }
+    });
+
+    return Sparse_Matrix<T>(size, std::move(kept), std::move(compact_columns), std::move(compact_values), symmetric);
+}
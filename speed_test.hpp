@@ -5,10 +5,14 @@
 //Programmers: Zachary Bahr and Jacob LeGrand
 
 #include <chrono>
+#include "sweep.h"
 using namespace std::chrono;
 
 /*! Test the speed of various mesh lengths using Gaussian elimination and Cholesky decomposition
 *
+*  The meshes are solved concurrently by a `Sweep_Engine`. Besides the two legacy text files,
+*  every measurement is written to speed_test.csv and speed_test.json.
+*
 *  \param lower_bound the lower bound of the mesh
 *  \param upper_bound the upper bound of the mesh
 *  \param max_mesh the maximum mesh length to be calculated and timed
@@ -16,30 +20,36 @@ using namespace std::chrono;
 *  \param *lower a pointer to the lower boundary function
 *  \param *right a pointer to the right boundary function
 *  \param *left a pointer to the left boundary function
+*  \param precision the floating point type to solve in
 * 
 *  \pre upper_bound > lower_bound
 *  \pre max_mesh > 0
-*  \pre Matrix_Solver<long double> is defined
 *  \post The speeds, in seconds, of Gaussian elimination and Cholesky decomposition for mesh lengths starting at 5 and increasing by 5 until reaching max_mesh are output to files
 *  \relates Matrix_Solver
 */
-void speed_test(const double lower_bound, const double upper_bound, const double max_mesh, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double)) {
-    ofstream fout;
+inline void speed_test(const double lower_bound, const double upper_bound, const double max_mesh, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double), const Precision precision = long_double_precision) {
+    Sweep_Engine sweep(lower_bound, upper_bound, upper, lower, right, left);
+
+    for (int i = 0; i < 2; i++) {
+        for (int mesh = 5; mesh <= max_mesh; mesh += 5) {
+            sweep.add_job(mesh, i ? gaussian_strategy : cholesky_strategy, precision);
+        }
+    }
+
+    cout << "Calculating mesh lengths 5 to " << max_mesh << " using Cholesky and Gaussian" << endl;
+    const Vector<Sweep_Result>& results = sweep.run();
 
-    for (int i=0; i<2; i++)
-    {
+    ofstream fout;
+    for (int i = 0; i < 2; i++) {
         fout.open(i ? "gaussian_times.txt" : "cholesky_times.txt");
-        for (int mesh = 5; mesh <= max_mesh; mesh+=5)
-        {
-            high_resolution_clock::time_point t1 = high_resolution_clock::now();
-            cout << "Calculating mesh length " << mesh << " using " << (i ? "Gaussian" : "Cholesky") <<endl;
-            Matrix_Solver<long double> solver(lower_bound, upper_bound, mesh, i, upper, lower, right, left);
-            Vector<long double> result;
-            result = solver.solve();
-            high_resolution_clock::time_point t2 = high_resolution_clock::now();
-            double elapsed = duration_cast<microseconds>(t2-t1).count() / 1000000.0;
-            fout << mesh << " " << elapsed << "\n";
+        for (int j = 0; j < results.get_size(); j++) {
+            if (results[j].job.strategy == (i ? gaussian_strategy : cholesky_strategy)) {
+                fout << results[j].job.mesh_length << " " << results[j].wall_seconds << "\n";
+            }
         }
         fout.close();
     }
+
+    sweep.write_csv("speed_test.csv");
+    sweep.write_json("speed_test.json");
 }
\ No newline at end of file
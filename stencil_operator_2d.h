@@ -0,0 +1,95 @@
+/*! \file
+ *  Stencil_Operator_2D class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef STENCIL_OPERATOR_2D_H
+#define STENCIL_OPERATOR_2D_H
+#include "linear_operator.h"
+#include "task_scheduler.h"
+
+/*! Matrix-free 5-point Laplacian on the interior points of a square mesh.
+ *
+ *  Every row is u - (1/4) * (sum of the 4 neighbours), the same product as the 5-point
+ *  coefficient matrix. Points are ordered with x fastest, then y.
+ *
+ *  The stencil is applied on a padded grid of (mesh_length + 1)^2 points (x fastest, row stride
+ *  mesh_length + 1) whose outer ring holds the boundary values (ghost cells). Every interior
+ *  row is then one branch-free, unit-stride SIMD loop (see vector_stencil_5pt).
+ */
+template <class T>
+class Stencil_Operator_2D : public Linear_Operator<T> {
+    private:
+        int m_mesh_length;
+        int m_row_length;
+
+    public:
+        /*! Constructs the operator for a given mesh
+          *
+          * \param mesh_length the mesh length (number of intervals along each edge)
+          * 
+          * \pre mesh_length > 1
+          * \post none
+          * \throws domain_error thrown if pre-condition broken
+        */
+        Stencil_Operator_2D(const int& mesh_length);
+
+        /*! Applies the 5-point stencil to `vec` (zero ghost cells, i.e. the coefficient matrix)
+          *
+          * \param vec the vector to apply the stencil to
+          * \return the product of the (implicit) coefficient matrix and `vec`
+          * 
+          * \pre vec.get_size() == (mesh_length - 1)^2
+          * \post (see return)
+          * \throws domain_error thrown if pre-condition broken
+        */
+        virtual Vector<T> operator*(const Vector<T>& vec) const;
+
+        /*! Applies the 5-point stencil to every interior point of a padded grid (rows are swept
+          * concurrently on the default scheduler)
+          *
+          * \param in the padded grid, with the ghost ring holding the boundary values
+          * \param out the padded grid to write the interior of (its ghost ring is not touched)
+          * 
+          * \pre `in` and `out` hold get_padded_size() elements and do not alias
+          * \post with zero ghost cells, the interior of `out` is A * (interior of `in`); with
+          *       boundary values in the ghost ring it is A * u - b, the residual of the system
+        */
+        void apply_padded(const T* in, T* out) const;
+
+        /*! Copies interior values into a padded grid with a zero ghost ring
+          *
+          * \pre vec.get_size() == get_size()
+          * \post (see return)
+          * \throws domain_error thrown if pre-condition broken
+        */
+        Vector<T> pad(const Vector<T>& vec) const;
+
+        /*! Copies the interior of a padded grid into an unpadded vector
+          *
+          * \pre padded.get_size() == get_padded_size()
+          * \post (see return)
+          * \throws domain_error thrown if pre-condition broken
+        */
+        Vector<T> unpad(const Vector<T>& padded) const;
+
+        /*! Applies the 5-point stencil to interleaved vectors, with the lanes innermost (see Linear_Operator)
+          *
+          * \pre `in` and `out` hold get_size() * lanes elements
+          * \post out holds the product of the operator with every lane of `in`
+        */
+        virtual void apply_interleaved(const T* in, T* out, const int& lanes) const;
+
+        /*! Gets the number of interior points, (mesh_length - 1)^2 */
+        virtual int get_size() const { return m_row_length * m_row_length; }
+
+        /*! Gets the estimated floating point operations of one product (6 per point) */
+        virtual double get_apply_flops() const { return 6.0 * double(get_size()); }
+
+        /*! Gets the number of points of the padded grid, (mesh_length + 1)^2 */
+        int get_padded_size() const { return (m_mesh_length + 1) * (m_mesh_length + 1); }
+};
+
+#include "stencil_operator_2d.hpp"
+#endif
@@ -0,0 +1,80 @@
+/*! \file
+ *  Function definitions for the `Stencil_Operator_2D` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Stencil_Operator_2D<T>::Stencil_Operator_2D(const int& mesh_length) : m_mesh_length(mesh_length), m_row_length(mesh_length - 1) {
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+}
+
+template <typename T>
+Vector<T> Stencil_Operator_2D<T>::operator*(const Vector<T>& vec) const {
+    Vector<T> padded = pad(vec);
+    Vector<T> result(padded);
+    apply_padded(padded.get_ptr(), result.get_ptr());
+
+    return unpad(result);
+}
+
+template <typename T>
+void Stencil_Operator_2D<T>::apply_padded(const T* in, T* out) const {
+    const int stride = m_mesh_length + 1;
+    const int n = m_row_length;
+
+    default_scheduler().parallel_for(1, m_mesh_length, [&](int j) {
+        const T* row = in + j * stride + 1;
+        vector_stencil_5pt(row - stride, row, row + stride, out + j * stride + 1, n);
+    });
+
+    return;
+}
+
+template <typename T>
+Vector<T> Stencil_Operator_2D<T>::pad(const Vector<T>& vec) const {
+    if (vec.get_size() != get_size()) { throw domain_error("Error: Vector must have one entry per interior mesh point."); }
+
+    const int stride = m_mesh_length + 1;
+    Vector<T> padded(get_padded_size(), 0);
+    for (int j = 0; j < m_row_length; j++) {
+        std::copy(vec.get_ptr() + j * m_row_length, vec.get_ptr() + (j + 1) * m_row_length, padded.get_ptr() + (j + 1) * stride + 1);
+    }
+
+    return padded;
+}
+
+template <typename T>
+Vector<T> Stencil_Operator_2D<T>::unpad(const Vector<T>& padded) const {
+    if (padded.get_size() != get_padded_size()) { throw domain_error("Error: Padded grid must have (mesh length + 1)^2 points."); }
+
+    const int stride = m_mesh_length + 1;
+    Vector<T> vec(get_size(), 0);
+    for (int j = 0; j < m_row_length; j++) {
+        std::copy(padded.get_ptr() + (j + 1) * stride + 1, padded.get_ptr() + (j + 1) * stride + 1 + m_row_length, vec.get_ptr() + j * m_row_length);
+    }
+
+    return vec;
+}
+
+template <typename T>
+void Stencil_Operator_2D<T>::apply_interleaved(const T* in, T* out, const int& lanes) const {
+    int n = m_row_length;
+
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int index = j * n + i;
+            const T* u = in + index * lanes;
+            T* result = out + index * lanes;
+
+            for (int l = 0; l < lanes; l++) { result[l] = 0; }
+            if (i > 0) { for (int l = 0; l < lanes; l++) result[l] += u[l - lanes]; }
+            if (i < n - 1) { for (int l = 0; l < lanes; l++) result[l] += u[l + lanes]; }
+            if (j > 0) { for (int l = 0; l < lanes; l++) result[l] += u[l - n * lanes]; }
+            if (j < n - 1) { for (int l = 0; l < lanes; l++) result[l] += u[l + n * lanes]; }
+            for (int l = 0; l < lanes; l++) { result[l] = u[l] - result[l] * T(0.25); }
+        }
+    }
+
+    return;
+}
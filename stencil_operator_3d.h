@@ -0,0 +1,60 @@
+/*! \file
+ *  Stencil_Operator_3D class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef STENCIL_OPERATOR_3D_H
+#define STENCIL_OPERATOR_3D_H
+#include "linear_operator.h"
+#include "task_scheduler.h"
+
+/*! Matrix-free 7-point Laplacian on the interior points of a cube mesh.
+ *
+ *  Every row is u - (1/6) * (sum of the 6 interior neighbours), the 3D analogue of the
+ *  5-point coefficient matrix. Points are ordered with x fastest, then y, then z.
+ */
+template <class T>
+class Stencil_Operator_3D : public Linear_Operator<T> {
+    private:
+        int m_mesh_length;
+        int m_row_length;
+
+    public:
+        /*! Constructs the operator for a given mesh
+          *
+          * \param mesh_length the mesh length (number of intervals along each edge)
+          * 
+          * \pre mesh_length > 1
+          * \post none
+          * \throws domain_error thrown if pre-condition broken
+        */
+        Stencil_Operator_3D(const int& mesh_length);
+
+        /*! Applies the 7-point stencil to `vec` (planes are swept concurrently on the default scheduler)
+          *
+          * \param vec the vector to apply the stencil to
+          * \return the product of the (implicit) coefficient matrix and `vec`
+          * 
+          * \pre vec.get_size() == (mesh_length - 1)^3
+          * \post (see return)
+          * \throws domain_error thrown if pre-condition broken
+        */
+        virtual Vector<T> operator*(const Vector<T>& vec) const;
+
+        /*! Applies the 7-point stencil to interleaved vectors, with the lanes innermost (see Linear_Operator)
+          *
+          * \pre `in` and `out` hold get_size() * lanes elements
+          * \post out holds the product of the operator with every lane of `in`
+        */
+        virtual void apply_interleaved(const T* in, T* out, const int& lanes) const;
+
+        /*! Gets the number of interior points, (mesh_length - 1)^3 */
+        virtual int get_size() const { return m_row_length * m_row_length * m_row_length; }
+
+        /*! Gets the estimated floating point operations of one product (8 per point) */
+        virtual double get_apply_flops() const { return 8.0 * double(get_size()); }
+};
+
+#include "stencil_operator_3d.hpp"
+#endif
@@ -0,0 +1,68 @@
+/*! \file
+ *  Function definitions for the `Stencil_Operator_3D` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+template <typename T>
+Stencil_Operator_3D<T>::Stencil_Operator_3D(const int& mesh_length) : m_mesh_length(mesh_length), m_row_length(mesh_length - 1) {
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+}
+
+template <typename T>
+Vector<T> Stencil_Operator_3D<T>::operator*(const Vector<T>& vec) const {
+    if (vec.get_size() != get_size()) { throw domain_error("Error: Vector must have one entry per interior mesh point."); }
+
+    int n = m_row_length;
+    int plane = n * n;
+    Vector<T> result(vec);
+    const T* u = vec.get_ptr();
+    T* out = result.get_ptr();
+
+    // Planes of constant z are swept concurrently
+    default_scheduler().parallel_for(0, n, [&](int k) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                int index = k * plane + j * n + i;
+                T sum = 0;
+                if (i > 0) sum += u[index - 1];
+                if (i < n - 1) sum += u[index + 1];
+                if (j > 0) sum += u[index - n];
+                if (j < n - 1) sum += u[index + n];
+                if (k > 0) sum += u[index - plane];
+                if (k < n - 1) sum += u[index + plane];
+                out[index] = u[index] - sum / T(6);
+            }
+        }
+    });
+
+    return result;
+}
+
+template <typename T>
+void Stencil_Operator_3D<T>::apply_interleaved(const T* in, T* out, const int& lanes) const {
+    int n = m_row_length;
+    int plane = n * n;
+    const T sixth = T(1) / T(6);
+
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                int index = k * plane + j * n + i;
+                const T* u = in + index * lanes;
+                T* result = out + index * lanes;
+
+                for (int l = 0; l < lanes; l++) { result[l] = 0; }
+                if (i > 0) { for (int l = 0; l < lanes; l++) result[l] += u[l - lanes]; }
+                if (i < n - 1) { for (int l = 0; l < lanes; l++) result[l] += u[l + lanes]; }
+                if (j > 0) { for (int l = 0; l < lanes; l++) result[l] += u[l - n * lanes]; }
+                if (j < n - 1) { for (int l = 0; l < lanes; l++) result[l] += u[l + n * lanes]; }
+                if (k > 0) { for (int l = 0; l < lanes; l++) result[l] += u[l - plane * lanes]; }
+                if (k < n - 1) { for (int l = 0; l < lanes; l++) result[l] += u[l + plane * lanes]; }
+                for (int l = 0; l < lanes; l++) { result[l] = u[l] - result[l] * sixth; }
+            }
+        }
+    }
+
+    return;
+}
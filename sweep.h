@@ -0,0 +1,143 @@
+/*! \file
+ *  Sweep_Engine class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef SWEEP_H
+#define SWEEP_H
+#include "matrix_solver.h"
+#include <ctime>
+#include <unistd.h>
+
+/*! Solver strategy of a sweep job */
+enum Sweep_Strategy { cholesky_strategy, gaussian_strategy };
+
+/*! One solve of a parameter sweep */
+struct Sweep_Job {
+    int mesh_length;
+    Sweep_Strategy strategy;
+    Precision precision;
+    Stencil stencil;
+};
+
+/*! Measurements of one finished sweep job */
+struct Sweep_Result {
+    Sweep_Job job;
+    int unknowns;
+    double wall_seconds;
+    // CPU time of the runner thread that ran the job; the parallel work the solve hands to the
+    // default_scheduler() workers is not included, so it undercounts jobs that parallelize
+    double runner_cpu_seconds;
+    long long memory_bytes;
+    double error_norm;
+    string status;
+};
+
+/*! Runs many (mesh, strategy, precision) solves of the same boundary value problem concurrently.
+ *
+ *  Jobs are started largest first, as long as the estimated memory of the running jobs stays
+ *  within the budget (a job larger than the whole budget runs alone). Every job is timed on its
+ *  own thread; the solves themselves still use the default scheduler for their parallel parts.
+ */
+class Sweep_Engine {
+    private:
+        double m_lower_bound;
+        double m_upper_bound;
+        double (*m_upper)(double, double);
+        double (*m_lower)(double, double);
+        double (*m_right)(double, double);
+        double (*m_left)(double, double);
+        long double (*m_exact)(long double, long double);
+
+        Vector<Sweep_Job> m_jobs;
+        Vector<Sweep_Result> m_results;
+
+        /*! Solves one job in precision T and measures it */
+        template <typename T>
+        Sweep_Result run_job(const Sweep_Job& job) const;
+
+    public:
+        /*! Constructs a sweep of the boundary value problem given by the bounds and boundary functions
+          *
+          * \param lower_bound the lower bound of the mesh
+          * \param upper_bound the upper bound of the mesh
+          * \param upper a pointer to the upper boundary function
+          * \param lower a pointer to the lower boundary function
+          * \param right a pointer to the right boundary function
+          * \param left a pointer to the left boundary function
+          * \param exact_eqn a pointer to the exact solution (nullptr to skip the error norm)
+          * 
+          * \pre upper_bound > lower_bound
+          * \pre the boundary functions are safe to call concurrently
+          * \post the sweep has no jobs
+          * \throws domain_error thrown if pre-condition 1 is broken
+        */
+        Sweep_Engine(const double& lower_bound, const double& upper_bound, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double), long double (*exact_eqn)(long double, long double) = nullptr);
+
+        /*! Adds a job to the sweep
+          *
+          * \pre mesh_length > 1
+          * \post the job is queued
+          * \throws domain_error thrown if pre-condition broken
+        */
+        void add_job(const int& mesh_length, const Sweep_Strategy& strategy, const Precision& precision, const Stencil& stencil = five_point);
+
+        /*! Runs every queued job
+          *
+          * \param memory_budget the most estimated bytes the running jobs may use together (0 for half of physical memory)
+          * \param max_concurrent the most jobs running at once (0 for the default scheduler's thread count)
+          * \return the results, in the order the jobs were added
+          * 
+          * The factor cache is disabled while the jobs run (its stored factorizations are dropped) and
+          * its capacity is restored afterwards, so every job factors its own matrix within the budget.
+          *
+          * \pre no other solves use the factor cache while the sweep runs
+          * \post every job has a result; a job that threw has its error message as status
+        */
+        const Vector<Sweep_Result>& run(const long long& memory_budget = 0, const int& max_concurrent = 0);
+
+        /*! Gets the results of the last run */
+        const Vector<Sweep_Result>& get_results() const { return m_results; }
+
+        /*! Writes the results as CSV (one header line, one line per job)
+          *
+          * \pre none
+          * \post the file is written
+          * \throws runtime_error thrown if the file cannot be opened
+        */
+        void write_csv(const string& file_name) const;
+
+        /*! Writes the results as a JSON array of objects
+          *
+          * \pre none
+          * \post the file is written
+          * \throws runtime_error thrown if the file cannot be opened
+        */
+        void write_json(const string& file_name) const;
+
+        /*! Writes a table comparing the time and error of every precision solved for the same
+          * mesh, strategy and stencil, with the speedup over long double
+          *
+          * \param out the stream to write to
+          * 
+          * \pre none
+          * \post the table is written
+        */
+        void write_precision_report(ostream& out) const;
+};
+
+/*! Estimates the peak bytes a dense solve of `job` allocates (matrix, working copies and factors)
+ *
+ * \relatesalso Sweep_Engine
+ */
+long long estimate_job_memory(const Sweep_Job& job);
+
+/*! Gets the name of a strategy as written to the result files
+ *
+ * \relatesalso Sweep_Engine
+ */
+string strategy_name(const Sweep_Strategy& strategy);
+
+#include "sweep.hpp"
+#endif
@@ -0,0 +1,226 @@
+/*! \file
+ *  Function definitions for the `Sweep_Engine` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+/*! Gets the CPU time used by the calling thread, in seconds
+ *
+ * \relatesalso Sweep_Engine
+ */
+inline double thread_cpu_seconds() {
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return now.tv_sec + now.tv_nsec / 1000000000.0;
+}
+
+inline string strategy_name(const Sweep_Strategy& strategy) {
+    return (strategy == gaussian_strategy) ? "gaussian" : "cholesky";
+}
+
+inline long long estimate_job_memory(const Sweep_Job& job) {
+    long long unknowns = (long long)(job.mesh_length - 1) * (job.mesh_length - 1);
+    long long element_size = (job.precision == float_precision) ? sizeof(float) : (job.precision == double_precision) ? sizeof(double) : sizeof(long double);
+
+    // About three dense n x n copies are alive at the peak of either strategy
+    return 3 * unknowns * unknowns * element_size;
+}
+
+inline Sweep_Engine::Sweep_Engine(const double& lower_bound, const double& upper_bound, double (*upper)(double, double), double (*lower)(double, double), double (*right)(double, double), double (*left)(double, double), long double (*exact_eqn)(long double, long double))
+    : m_lower_bound(lower_bound), m_upper_bound(upper_bound), m_upper(upper), m_lower(lower), m_right(right), m_left(left), m_exact(exact_eqn) {
+    if (upper_bound <= lower_bound) { throw domain_error("Error: Upper bound should be greater than lower bound."); }
+}
+
+inline void Sweep_Engine::add_job(const int& mesh_length, const Sweep_Strategy& strategy, const Precision& precision, const Stencil& stencil) {
+    if (mesh_length <= 1) { throw domain_error("Error: Mesh length should be greater than 1."); }
+
+    Sweep_Job job = { mesh_length, strategy, precision, stencil };
+    m_jobs.push_back(job);
+
+    return;
+}
+
+template <typename T>
+Sweep_Result Sweep_Engine::run_job(const Sweep_Job& job) const {
+    Sweep_Result result;
+    result.job = job;
+    result.unknowns = (job.mesh_length - 1) * (job.mesh_length - 1);
+    result.memory_bytes = estimate_job_memory(job);
+    result.error_norm = -1;
+    result.status = "ok";
+
+    double cpu_start = thread_cpu_seconds();
+    chrono::steady_clock::time_point wall_start = chrono::steady_clock::now();
+
+    try {
+        Matrix_Solver<T> solver(m_lower_bound, m_upper_bound, job.mesh_length, job.strategy == gaussian_strategy, m_upper, m_lower, m_right, m_left, job.stencil);
+        Vector<T> solution = solver.solve();
+
+        result.wall_seconds = chrono::duration<double>(chrono::steady_clock::now() - wall_start).count();
+        result.runner_cpu_seconds = thread_cpu_seconds() - cpu_start;
+
+        if (m_exact != nullptr) {
+            Vector<T> exact_solution = gen_exact_sol<T>(m_lower_bound, m_upper_bound, job.mesh_length, m_exact);
+            result.error_norm = double(error_norm(m_lower_bound, m_upper_bound, job.mesh_length, solution, exact_solution));
+        }
+    }
+    catch (const exception& err) {
+        result.wall_seconds = chrono::duration<double>(chrono::steady_clock::now() - wall_start).count();
+        result.runner_cpu_seconds = thread_cpu_seconds() - cpu_start;
+        result.status = err.what();
+    }
+
+    return result;
+}
+
+inline const Vector<Sweep_Result>& Sweep_Engine::run(const long long& memory_budget, const int& max_concurrent) {
+    int num_jobs = m_jobs.get_size();
+    long long budget = memory_budget;
+    if (budget <= 0) { budget = (long long)sysconf(_SC_PHYS_PAGES) * sysconf(_SC_PAGE_SIZE) / 2; }
+    int num_runners = (max_concurrent > 0) ? max_concurrent : default_scheduler().get_num_threads();
+
+    // Largest jobs first so the long ones do not end up running last, alone
+    std::vector<int> order;
+    for (int i = 0; i < num_jobs; i++) { order.push_back(i); }
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) { return estimate_job_memory(m_jobs[a]) > estimate_job_memory(m_jobs[b]); });
+
+    m_results = Vector<Sweep_Result>(num_jobs, Sweep_Result());
+
+    // Factorizations left in the factor cache would hold memory outside the budget, and a repeated
+    // job would time a cache hit; the cache is off for the sweep, as in the benchmark
+    size_t cache_capacity = factor_cache().get_stats().capacity;
+    factor_cache().set_capacity(0);
+
+    std::mutex mutex;
+    std::condition_variable released;
+    size_t next = 0;
+    long long in_use = 0;
+    int running = 0;
+
+    // Each runner takes the next job once it fits in the budget (or nothing else is running)
+    auto runner = [&]() {
+        while (true) {
+            int index;
+            long long bytes;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (next == order.size()) { return; }
+                bytes = estimate_job_memory(m_jobs[order[next]]);
+                released.wait(lock, [&] { return next == order.size() || running == 0 || in_use + bytes <= budget; });
+                if (next == order.size()) { return; }
+
+                index = order[next++];
+                bytes = estimate_job_memory(m_jobs[index]);
+                in_use += bytes;
+                running++;
+            }
+
+            Sweep_Result result;
+            if (m_jobs[index].precision == float_precision) { result = run_job<float>(m_jobs[index]); }
+            else if (m_jobs[index].precision == double_precision) { result = run_job<double>(m_jobs[index]); }
+            else { result = run_job<long double>(m_jobs[index]); }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                m_results[index] = result;
+                in_use -= bytes;
+                running--;
+            }
+            released.notify_all();
+        }
+    };
+
+    std::vector<std::thread> runners;
+    for (int i = 0; i < min(num_runners, num_jobs); i++) { runners.push_back(std::thread(runner)); }
+    for (size_t i = 0; i < runners.size(); i++) { runners[i].join(); }
+    factor_cache().set_capacity(cache_capacity);
+
+    return m_results;
+}
+
+inline void Sweep_Engine::write_csv(const string& file_name) const {
+    ofstream fout(file_name);
+    if (!fout) { throw runtime_error("Error: Could not open " + file_name + " for writing."); }
+
+    fout << setprecision(PRECISION);
+    fout << "mesh_length,strategy,precision,stencil,unknowns,wall_seconds,runner_cpu_seconds,memory_bytes,error_norm,status\n";
+    for (int i = 0; i < m_results.get_size(); i++) {
+        const Sweep_Result& r = m_results[i];
+        string status = r.status;
+        std::replace(status.begin(), status.end(), '"', '\'');
+
+        fout << r.job.mesh_length << "," << strategy_name(r.job.strategy) << "," << precision_name(r.job.precision) << ","
+             << (r.job.stencil == nine_point ? "9-point" : "5-point") << ","
+             << r.unknowns << "," << r.wall_seconds << "," << r.runner_cpu_seconds << "," << r.memory_bytes << ","
+             << r.error_norm << ",\"" << status << "\"\n";
+    }
+
+    return;
+}
+
+inline void Sweep_Engine::write_json(const string& file_name) const {
+    ofstream fout(file_name);
+    if (!fout) { throw runtime_error("Error: Could not open " + file_name + " for writing."); }
+
+    fout << setprecision(PRECISION);
+    fout << "[\n";
+    for (int i = 0; i < m_results.get_size(); i++) {
+        const Sweep_Result& r = m_results[i];
+        string status = r.status;
+        std::replace(status.begin(), status.end(), '"', '\'');
+        std::replace(status.begin(), status.end(), '\\', '/');
+
+        fout << "  {\"mesh_length\": " << r.job.mesh_length
+             << ", \"strategy\": \"" << strategy_name(r.job.strategy) << "\""
+             << ", \"precision\": \"" << precision_name(r.job.precision) << "\""
+             << ", \"stencil\": \"" << (r.job.stencil == nine_point ? "9-point" : "5-point") << "\""
+             << ", \"unknowns\": " << r.unknowns
+             << ", \"wall_seconds\": " << r.wall_seconds
+             << ", \"runner_cpu_seconds\": " << r.runner_cpu_seconds
+             << ", \"memory_bytes\": " << r.memory_bytes
+             << ", \"error_norm\": ";
+        // JSON has no NaN or infinity, so a failed norm is written as null
+        if (std::isfinite(r.error_norm)) { fout << r.error_norm; }
+        else { fout << "null"; }
+        fout << ", \"status\": \"" << status << "\"}" << (i + 1 < m_results.get_size() ? ",\n" : "\n");
+    }
+    fout << "]\n";
+
+    return;
+}
+
+inline void Sweep_Engine::write_precision_report(ostream& out) const {
+    std::vector<bool> reported(m_results.get_size(), false);
+
+    for (int i = 0; i < m_results.get_size(); i++) {
+        if (reported[i]) { continue; }
+        const Sweep_Job& job = m_results[i].job;
+
+        // Every result of the same problem, and the long double time to compare against
+        std::vector<int> group;
+        double reference_seconds = 0;
+        for (int j = i; j < m_results.get_size(); j++) {
+            const Sweep_Job& other = m_results[j].job;
+            if (other.mesh_length != job.mesh_length || other.strategy != job.strategy || other.stencil != job.stencil) { continue; }
+            group.push_back(j);
+            reported[j] = true;
+            if (other.precision == long_double_precision) { reference_seconds = m_results[j].wall_seconds; }
+        }
+
+        out << "Mesh " << job.mesh_length << ", " << strategy_name(job.strategy) << ", " << (job.stencil == nine_point ? "9-point" : "5-point") << "\n";
+        out << "  " << std::left << setw(14) << "precision" << setw(14) << "time (s)" << setw(16) << "error norm" << "speedup" << "\n";
+        for (size_t g = 0; g < group.size(); g++) {
+            const Sweep_Result& r = m_results[group[g]];
+            out << "  " << setw(14) << precision_name(r.job.precision) << setw(14) << setprecision(4) << r.wall_seconds << setw(16);
+            if (r.status != "ok") { out << r.status << "\n"; continue; }
+            if (r.error_norm < 0) { out << "-"; }
+            else { out << setprecision(6) << r.error_norm; }
+            if (reference_seconds > 0 && r.wall_seconds > 0) { out << setprecision(3) << reference_seconds / r.wall_seconds << "x"; }
+            out << "\n";
+        }
+        out << std::right;
+    }
+
+    return;
+}
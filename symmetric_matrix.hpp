@@ -38,7 +38,11 @@ Symmetric_Matrix<T>::Symmetric_Matrix(const Base_Matrix<T>& source) : General_Ma
 }
 
 template <typename T>
-Symmetric_Matrix<T>::Symmetric_Matrix(Symmetric_Matrix<T>&& other) : General_Matrix<T>(other), m_state(other.m_state) {} 
+Symmetric_Matrix<T>::Symmetric_Matrix(Symmetric_Matrix<T>&& other) : General_Matrix<T>(other.m_size), m_state(other.m_state) {
+    std::swap(this->m_elements, other.m_elements);
+    this->m_size = other.m_size;
+    other.m_size = 0;
+} 
 
 template <typename T>
 Symmetric_Matrix<T>& Symmetric_Matrix<T>::operator=(const Symmetric_Matrix<T>& source) {
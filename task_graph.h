@@ -0,0 +1,73 @@
+/*! \file
+ *  Task_Graph class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+#include "task_scheduler.h"
+#include <memory>
+
+/*! Dependency graph of tasks executed out of order on a `Task_Scheduler`.
+ *
+ *  A task becomes ready once every task it depends on has finished; the task that finishes
+ *  last spawns it on the scheduler as an ordinary task, so no thread is held by the graph and
+ *  other work (concurrent solves) keeps being scheduled. Ready tasks released together are
+ *  spawned so that the finishing worker continues with the highest priority one, where the
+ *  priority of a task is the cost of the longest path from it to the end of the graph
+ *  (critical path first), so work on the critical path is not starved by work that can wait
+ *  (look-ahead).
+ */
+class Task_Graph {
+    private:
+        /*! A task and its edges */
+        struct Node {
+            std::function<void()> work;
+            double cost;
+            double priority;
+            int num_dependencies;
+            std::vector<int> successors;
+        };
+
+        std::vector<Node> m_nodes;
+
+        /*! Computes every node's priority (longest cost path to a sink) */
+        void compute_priorities();
+
+    public:
+        /*! Adds a task
+          *
+          * \param work the function to run
+          * \param cost the estimated cost of the task (used for critical path priorities)
+          * \return the id of the task
+          * 
+          * \pre cost >= 0
+          * \post the task is added with no dependencies
+        */
+        int add_task(const std::function<void()>& work, const double& cost);
+
+        /*! Makes task `after` wait for task `before`
+          *
+          * \pre both ids were returned by add_task and before < after
+          * \post `after` will not start until `before` has finished
+          * \throws out_of_range thrown if pre-condition broken
+        */
+        void add_dependency(const int& before, const int& after);
+
+        /*! Gets the number of tasks in the graph */
+        int get_size() const { return static_cast<int>(m_nodes.size()); }
+
+        /*! Runs every task, respecting the dependencies, on `scheduler`
+          *
+          * \param scheduler the scheduler whose threads run the tasks
+          * 
+          * \pre the graph is acyclic (guaranteed by the before < after rule)
+          * \post every task has run once
+          * \throws rethrows the first exception thrown by a task (tasks not yet started are skipped)
+        */
+        void run(Task_Scheduler& scheduler);
+};
+
+#include "task_graph.hpp"
+#endif
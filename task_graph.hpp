@@ -0,0 +1,91 @@
+/*! \file
+ *  Function definitions for the `Task_Graph` class.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline int Task_Graph::add_task(const std::function<void()>& work, const double& cost) {
+    Node node;
+    node.work = work;
+    node.cost = cost;
+    node.priority = 0;
+    node.num_dependencies = 0;
+    m_nodes.push_back(node);
+
+    return get_size() - 1;
+}
+
+inline void Task_Graph::add_dependency(const int& before, const int& after) {
+    if (before < 0 || after >= get_size() || before >= after) { throw out_of_range("Error: Invalid task dependency."); }
+
+    m_nodes[before].successors.push_back(after);
+    m_nodes[after].num_dependencies++;
+
+    return;
+}
+
+inline void Task_Graph::compute_priorities() {
+    // Successors always have larger ids, so one reverse sweep finds the longest paths
+    for (int id = get_size() - 1; id >= 0; id--) {
+        double longest = 0;
+        for (size_t i = 0; i < m_nodes[id].successors.size(); i++) {
+            longest = max(longest, m_nodes[m_nodes[id].successors[i]].priority);
+        }
+        m_nodes[id].priority = m_nodes[id].cost + longest;
+    }
+
+    return;
+}
+
+inline void Task_Graph::run(Task_Scheduler& scheduler) {
+    if (m_nodes.empty()) { return; }
+
+    compute_priorities();
+
+    // Dependencies left per task; the task that finishes the last one spawns the successor
+    std::unique_ptr<std::atomic<int>[]> remaining_dependencies(new std::atomic<int>[m_nodes.size()]);
+    std::vector<int> sources;
+    for (int id = 0; id < get_size(); id++) {
+        remaining_dependencies[id] = m_nodes[id].num_dependencies;
+        if (m_nodes[id].num_dependencies == 0) { sources.push_back(id); }
+    }
+
+    Task_Group group(scheduler);
+    std::atomic<bool> failed(false);
+    std::function<void(const int)> execute;
+
+    // Spawns ready tasks lowest priority first (then by id, earlier tasks first on ties): a worker
+    // runs its own deque newest first, so it continues with the most critical task and leaves the
+    // others to be stolen
+    auto spawn_ready = [&](std::vector<int>& ready) {
+        std::sort(ready.begin(), ready.end(), [this](int a, int b) {
+            return (m_nodes[a].priority != m_nodes[b].priority) ? m_nodes[a].priority < m_nodes[b].priority : a > b;
+        });
+        for (size_t i = 0; i < ready.size(); i++) {
+            int id = ready[i];
+            group.run([&execute, id]() { execute(id); });
+        }
+    };
+
+    execute = [&](const int id) {
+        if (failed) { return; }
+        try { m_nodes[id].work(); }
+        catch (...) {
+            failed = true;
+            throw;
+        }
+
+        std::vector<int> ready;
+        for (size_t i = 0; i < m_nodes[id].successors.size(); i++) {
+            int successor = m_nodes[id].successors[i];
+            if (--remaining_dependencies[successor] == 0) { ready.push_back(successor); }
+        }
+        spawn_ready(ready);
+    };
+
+    // No thread blocks on the graph: the waiting thread helps with queued tasks (of this graph or any other)
+    spawn_ready(sources);
+    group.wait();
+
+    return;
+}
@@ -0,0 +1,189 @@
+/*! \file
+ *  Task_Scheduler and Task_Group class definition/declaration.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+#include "libraries.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! Environment variable read for the thread count of the default scheduler */
+const char* const NUM_THREADS_VARIABLE = "FDS_NUM_THREADS";
+
+/*! Times a thread waiting on a `Task_Group` yields with nothing to run before it blocks */
+const int TASK_WAIT_SPINS = 64;
+
+/*! Work-stealing task scheduler shared by all solvers.
+ *
+ *  Every worker owns a deque: it pushes and pops its own tasks at the back (newest first, for
+ *  cache reuse) and, when it runs dry, steals from the front of the other deques (oldest, so
+ *  the biggest pieces of work move). Threads outside the pool submit to a shared deque.
+ *  Threads waiting on a `Task_Group` run queued tasks; with nothing to run they yield a few
+ *  times and then block until a task is queued or their group finishes.
+ */
+class Task_Scheduler {
+    private:
+        /*! A locked deque of tasks */
+        struct Task_Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()> > tasks;
+        };
+
+        // Queue 0 is shared by threads outside the pool; queue i belongs to worker i
+        std::vector<std::thread> m_workers;
+        std::vector<std::unique_ptr<Task_Queue> > m_queues;
+
+        // Sleeping when no task is queued anywhere
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+        std::atomic<int> m_queued;
+        bool m_stopping;
+
+        // Threads blocked in wait_for_work (woken by spawn and by finishing groups)
+        std::condition_variable m_waiting;
+        std::atomic<int> m_blocked_waiters;
+
+        /*! Loop run by worker `index`: run tasks until the scheduler stops */
+        void worker_loop(const int index);
+
+        /*! Pops a task from queue `index` (back) or steals one from another queue (front) */
+        bool take_task(const int index, std::function<void()>& task);
+
+        /*! Index of the queue owned by the calling thread (0 if it is not one of our workers) */
+        int current_queue() const;
+
+        /*! Starts `num_threads - 1` workers */
+        void start(const int num_threads);
+
+        /*! Stops and joins the workers */
+        void stop();
+
+    public:
+        /*! Constructs a scheduler
+          *
+          * \param num_threads the number of threads running tasks, including the thread that waits
+          *        (so num_threads - 1 workers are started)
+          * 
+          * \pre none
+          * \post the workers are started; values below 1 are treated as 1
+        */
+        Task_Scheduler(const int& num_threads);
+
+        /*! Destructor
+          * 
+          * \pre no tasks are queued or running
+          * \post the workers are joined
+        */
+        ~Task_Scheduler();
+
+        /*! Gets the number of threads running tasks (workers + the waiting thread) */
+        int get_num_threads() const { return static_cast<int>(m_workers.size()) + 1; }
+
+        /*! Restarts the scheduler with a different number of threads
+          *
+          * \param num_threads the new thread count (see constructor)
+          * 
+          * \pre no tasks are queued or running
+          * \post the scheduler runs with `num_threads` threads
+        */
+        void resize(const int& num_threads);
+
+        /*! Queues a task on the calling worker's deque (or the shared deque for other threads)
+          *
+          * \param task the task to run
+          * 
+          * \pre none
+          * \post the task is queued and a sleeping worker is woken
+        */
+        void spawn(const std::function<void()>& task);
+
+        /*! Runs one queued task on the calling thread, if any (used by waiting threads)
+          *
+          * \return true if a task was run
+        */
+        bool run_pending_task();
+
+        /*! Blocks the calling thread until a task is queued or `pending` reaches 0 (used by waiting threads)
+          *
+          * \param pending the unfinished task count of the group being waited on
+          * \post a task may be queued, or pending == 0
+        */
+        void wait_for_work(const std::atomic<int>& pending);
+
+        /*! Wakes the threads blocked in wait_for_work (called when a group's last task finishes) */
+        void notify_waiters();
+
+        /*! Calls body(i) for every i in [begin, end)
+          *
+          * The range is split in halves recursively (fork/join) until pieces are at most
+          * `grain_size` indices; idle workers steal the larger halves.
+          *
+          * \param begin the first index
+          * \param end one past the last index
+          * \param body the loop body; calls for different indices may run concurrently
+          * \param grain_size the largest piece run serially (0 picks about 8 pieces per thread)
+          * 
+          * \pre body is safe to call concurrently for different indices
+          * \post body has been called for every index in the range
+          * \throws rethrows the first exception thrown by body
+        */
+        template <typename Body>
+        void parallel_for(const int& begin, const int& end, const Body& body, const int& grain_size = 0);
+};
+
+/*! Fork/join group of tasks on a `Task_Scheduler` */
+class Task_Group {
+    private:
+        /*! State shared with the spawned tasks */
+        struct Group_State {
+            std::atomic<int> pending;
+            std::mutex mutex;
+            std::exception_ptr error;
+        };
+
+        Task_Scheduler& m_scheduler;
+        std::shared_ptr<Group_State> m_state;
+
+    public:
+        /*! Constructs an empty group on `scheduler` */
+        Task_Group(Task_Scheduler& scheduler);
+
+        /*! Destructor (waits for outstanding tasks, discarding their exceptions) */
+        ~Task_Group();
+
+        /*! Forks `task` onto the scheduler
+          *
+          * \pre none
+          * \post the task is queued
+        */
+        void run(const std::function<void()>& task);
+
+        /*! Joins every task forked so far, running queued tasks while waiting
+          *
+          * \pre none
+          * \post all tasks of the group have finished
+          * \throws rethrows the first exception thrown by a task of the group
+        */
+        void wait();
+};
+
+/*! Gets the scheduler shared by the library. Its thread count is taken from the
+ *  FDS_NUM_THREADS environment variable, or the number of hardware threads if unset.
+ *
+ * \relatesalso Task_Scheduler
+ */
+Task_Scheduler& default_scheduler();
+
+#include "task_scheduler.hpp"
+#endif
@@ -0,0 +1,257 @@
+/*! \file
+ *  Function definitions for the `Task_Scheduler` and `Task_Group` classes.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+/*! Scheduler and queue index of the calling thread (set for workers only) */
+struct Worker_Identity {
+    const Task_Scheduler* scheduler;
+    int index;
+};
+
+/*! Gets the identity of the calling thread
+ *
+ * \relatesalso Task_Scheduler
+ */
+inline Worker_Identity& current_worker() {
+    static thread_local Worker_Identity identity = { nullptr, 0 };
+    return identity;
+}
+
+inline Task_Scheduler::Task_Scheduler(const int& num_threads) : m_queued(0), m_stopping(false), m_blocked_waiters(0) {
+    start(num_threads);
+}
+
+inline Task_Scheduler::~Task_Scheduler() {
+    stop();
+}
+
+inline void Task_Scheduler::start(const int num_threads) {
+    int workers = max(num_threads, 1) - 1;
+    m_stopping = false;
+
+    m_queues.clear();
+    for (int i = 0; i <= workers; i++) {
+        m_queues.push_back(std::unique_ptr<Task_Queue>(new Task_Queue()));
+    }
+
+    for (int i = 1; i <= workers; i++) {
+        m_workers.push_back(std::thread(&Task_Scheduler::worker_loop, this, i));
+    }
+
+    return;
+}
+
+inline void Task_Scheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        m_workers[i].join();
+    }
+    m_workers.clear();
+
+    return;
+}
+
+inline void Task_Scheduler::resize(const int& num_threads) {
+    if (max(num_threads, 1) == get_num_threads()) { return; }
+
+    stop();
+    start(num_threads);
+
+    return;
+}
+
+inline int Task_Scheduler::current_queue() const {
+    const Worker_Identity& identity = current_worker();
+    return (identity.scheduler == this) ? identity.index : 0;
+}
+
+inline bool Task_Scheduler::take_task(const int index, std::function<void()>& task) {
+    int num_queues = static_cast<int>(m_queues.size());
+
+    for (int offset = 0; offset < num_queues; offset++) {
+        int victim = (index + offset) % num_queues;
+        Task_Queue& queue = *m_queues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) { continue; }
+
+        // Own queue is used as a stack, other queues are stolen from the opposite end
+        if (offset == 0) {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+        }
+        else {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+        m_queued--;
+
+        return true;
+    }
+
+    return false;
+}
+
+inline void Task_Scheduler::worker_loop(const int index) {
+    current_worker().scheduler = this;
+    current_worker().index = index;
+
+    std::function<void()> task;
+    while (true) {
+        if (take_task(index, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_wake.wait(lock, [this] { return m_stopping || m_queued > 0; });
+        if (m_stopping) { return; }
+    }
+}
+
+inline void Task_Scheduler::spawn(const std::function<void()>& task) {
+    Task_Queue& queue = *m_queues[current_queue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+    m_queued++;
+
+    if (!m_workers.empty()) {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_wake.notify_one();
+    }
+    notify_waiters();
+
+    return;
+}
+
+inline bool Task_Scheduler::run_pending_task() {
+    std::function<void()> task;
+    if (!take_task(current_queue(), task)) { return false; }
+
+    task();
+
+    return true;
+}
+
+inline void Task_Scheduler::wait_for_work(const std::atomic<int>& pending) {
+    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+    m_blocked_waiters++;
+    m_waiting.wait(lock, [this, &pending] { return m_queued > 0 || pending == 0; });
+    m_blocked_waiters--;
+
+    return;
+}
+
+inline void Task_Scheduler::notify_waiters() {
+    // Waiters register before checking their condition, so one that is missed here sees the change itself
+    if (m_blocked_waiters > 0) {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_waiting.notify_all();
+    }
+
+    return;
+}
+
+/*! Runs body(i) over [begin, end), forking the upper half of the range until pieces are at most `grain_size`
+ *
+ * \relatesalso Task_Scheduler
+ */
+template <typename Body>
+void parallel_for_range(Task_Scheduler& scheduler, int begin, int end, const int grain_size, const Body& body) {
+    Task_Group group(scheduler);
+
+    while (end - begin > grain_size) {
+        int middle = begin + (end - begin) / 2;
+        int upper_end = end;
+        group.run([&scheduler, middle, upper_end, grain_size, &body]() { parallel_for_range(scheduler, middle, upper_end, grain_size, body); });
+        end = middle;
+    }
+
+    for (int i = begin; i < end; i++) { body(i); }
+
+    group.wait();
+
+    return;
+}
+
+template <typename Body>
+void Task_Scheduler::parallel_for(const int& begin, const int& end, const Body& body, const int& grain_size) {
+    if (end <= begin) { return; }
+
+    int grain = grain_size;
+    if (grain <= 0) { grain = max(1, (end - begin) / (8 * get_num_threads())); }
+
+    parallel_for_range(*this, begin, end, grain, body);
+
+    return;
+}
+
+inline Task_Group::Task_Group(Task_Scheduler& scheduler) : m_scheduler(scheduler), m_state(std::make_shared<Group_State>()) {
+    m_state->pending = 0;
+}
+
+inline Task_Group::~Task_Group() {
+    try { wait(); }
+    catch (...) {}
+}
+
+inline void Task_Group::run(const std::function<void()>& task) {
+    std::shared_ptr<Group_State> state = m_state;
+    Task_Scheduler* scheduler = &m_scheduler;
+    state->pending++;
+
+    m_scheduler.spawn([state, scheduler, task]() {
+        try { task(); }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->error) { state->error = std::current_exception(); }
+        }
+        if (--state->pending == 0) { scheduler->notify_waiters(); }
+    });
+
+    return;
+}
+
+inline void Task_Group::wait() {
+    // Help with queued work; with nothing to run, yield a few times (the last tasks are usually
+    // about to finish elsewhere) and then block until a task is queued or the group finishes
+    int spins = 0;
+    while (m_state->pending > 0) {
+        if (m_scheduler.run_pending_task()) { spins = 0; }
+        else if (spins < TASK_WAIT_SPINS) {
+            spins++;
+            std::this_thread::yield();
+        }
+        else {
+            m_scheduler.wait_for_work(m_state->pending);
+            spins = 0;
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        std::swap(error, m_state->error);
+    }
+    if (error) { std::rethrow_exception(error); }
+
+    return;
+}
+
+inline Task_Scheduler& default_scheduler() {
+    static Task_Scheduler scheduler([]() {
+        const char* value = getenv(NUM_THREADS_VARIABLE);
+        int num_threads = (value != nullptr) ? atoi(value) : 0;
+        return (num_threads > 0) ? num_threads : static_cast<int>(std::thread::hardware_concurrency());
+    }());
+
+    return scheduler;
+}
@@ -210,6 +210,20 @@ class U_Triangle_Matrix : public virtual General_Matrix<T> {
           * \throws std::domain_error is thrown if division by zero occurs
         */
         virtual Vector<T> back_sub(const Vector<Vector<T>>& matrix_data, const Vector<T>& vec) const; 
+
+        /*! Solves U * x = b in place for `lanes` right hand sides stored interleaved (AoSoA block:
+          * element i of right hand side l at block[i * lanes + l]). Every scalar step of the substitution
+          * runs across all lanes as one vector instruction of the best instruction set the CPU supports
+          * (see vector_interleaved_update).
+          *
+          * \param block the interleaved right hand sides, overwritten with the solutions
+          * 
+          * \pre `block` holds m_size * lanes elements
+          * \post (see description)
+          * \throws std::domain_error is thrown if division by zero occurs
+        */
+        template <int lanes>
+        void back_sub_interleaved(T* block) const;
 };
 
 /*! Stream extraction operator for `U_Triangle_Matrix`. Data is read in as if it is in upper-triangular matrix form. Any matrix members that would be "zeroes" are discarded.
@@ -31,7 +31,11 @@ U_Triangle_Matrix<T>::U_Triangle_Matrix(const Base_Matrix<T>& source) : General_
 } 
 
 template <typename T>
-U_Triangle_Matrix<T>::U_Triangle_Matrix(U_Triangle_Matrix<T>&& other) : General_Matrix<T>(other), m_state(other.m_state) {}
+U_Triangle_Matrix<T>::U_Triangle_Matrix(U_Triangle_Matrix<T>&& other) : General_Matrix<T>(other.m_size), m_state(other.m_state) {
+    std::swap(this->m_elements, other.m_elements);
+    this->m_size = other.m_size;
+    other.m_size = 0;
+}
 
 template <typename T>
 U_Triangle_Matrix<T>& U_Triangle_Matrix<T>::operator=(const U_Triangle_Matrix<T>& source) {
@@ -198,6 +202,25 @@ Vector<T> U_Triangle_Matrix<T>::back_sub(const Vector<Vector<T>>& matrix_data, c
     return result;
 }
 
+template <typename T>
+template <int lanes>
+void U_Triangle_Matrix<T>::back_sub_interleaved(T* block) const {
+    for (int row = this->m_size - 1; row >= 0; row--) {
+        // Row `row` stores the elements from the diagonal onwards
+        const T* u_row = this->m_elements[row].get_ptr();
+        if (u_row[0] == 0) { throw domain_error("Error: Division by zero during back substitution."); }
+
+        T sum[lanes];
+        for (int l = 0; l < lanes; l++) { sum[l] = block[row * lanes + l]; }
+
+        vector_interleaved_update<lanes>(u_row + 1, this->m_size - row - 1, block + (row + 1) * lanes, sum);
+
+        for (int l = 0; l < lanes; l++) { block[row * lanes + l] = sum[l] / u_row[0]; }
+    }
+
+    return;
+}
+
 template <typename T>
 istream& operator>>(istream& in, U_Triangle_Matrix<T>& matrix_in) {
     for (int i = 0; i < matrix_in.get_max(); i++) {
@@ -7,6 +7,8 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 #include "libraries.h"
+#include "vector_kernels.h"
+#include "allocation_counter.h"
 
 /*! Vector class adapted from Barton and Nackman's Array class.
  */
@@ -24,6 +26,15 @@ class Vector {
          */
         void vector_copy(const Vector& source);
 
+        /*! Allocates storage for count elements, recording it with allocation_counter()
+         *
+         *  \return the new storage
+         */
+        static T* allocate(const int& count);
+
+        /*! Frees storage for count elements obtained from allocate (nullptr is ignored) */
+        static void release(T* data, const int& count);
+
     public:
         /*! Constructs an empty vector
          * 
@@ -190,6 +201,31 @@ class Vector {
          */
         Vector<T> operator*(const T& scalar) const;
 
+        /*! Adds `a` times x to this container in place (no temporaries)
+         *
+         *  \param a the scale of x
+         *  \param x the vector to add
+         *  \return a reference to `this` vector with updated entries
+         * 
+         *  \pre  m_size == x.m_size
+         *  \post *this = *this + a * x
+         *  \throws std::domain_error is thrown if m_size != x.m_size
+         */
+        Vector<T>& axpy(const T& a, const Vector<T>& x);
+
+        /*! Replaces this container with `a` times x plus `b` times itself in place (no temporaries)
+         *
+         *  \param a the scale of x
+         *  \param x the vector to add
+         *  \param b the scale of *this
+         *  \return a reference to `this` vector with updated entries
+         * 
+         *  \pre  m_size == x.m_size
+         *  \post *this = a * x + b * *this
+         *  \throws std::domain_error is thrown if m_size != x.m_size
+         */
+        Vector<T>& axpby(const T& a, const Vector<T>& x, const T& b);
+
         // Setters
         /*! Resets the vector capacity and sets a default value
          * 
@@ -197,7 +233,7 @@ class Vector {
          *  \pre  T() has been defined and is a numeric type
          *  \post the container is now of of size size, every 
          *        element in the container has a default value,
-         *        and m_max is double the size
+         *        and m_max is at least the size
          */
         void reset_vector(const int& size);
 
@@ -5,13 +5,13 @@
 //Programmers: Zachary Bahr and Jacob LeGrand
 
 template <typename T>
-Vector<T>::Vector() : m_size(0), m_max(DEFAULT_MAX), ptr_to_data(new T[DEFAULT_MAX]) {}
+Vector<T>::Vector() : m_size(0), m_max(DEFAULT_MAX), ptr_to_data(allocate(DEFAULT_MAX)) {}
 
 template <typename T>
-Vector<T>::Vector(const int& max_size) : m_size(0), m_max(max_size), ptr_to_data(new T[max_size]) { }
+Vector<T>::Vector(const int& max_size) : m_size(0), m_max(max_size), ptr_to_data(allocate(max_size)) { }
 
 template <typename T>
-Vector<T>::Vector(const int& max_size, const T& default_val) : m_size(max_size), m_max(max_size), ptr_to_data(new T[max_size]) {
+Vector<T>::Vector(const int& max_size, const T& default_val) : m_size(max_size), m_max(max_size), ptr_to_data(allocate(max_size)) {
     for (int i = 0; i < max_size; i++) {
         ptr_to_data[i] = default_val;
     }
@@ -21,12 +21,14 @@ template <typename T>
 Vector<T>::Vector(const Vector<T>& source) {
     m_size = source.get_size();
     m_max = source.get_max();
-    ptr_to_data = new T[m_max];
+    ptr_to_data = allocate(m_max);
     vector_copy(source);
 }
 
 template <typename T>
 Vector<T>::Vector(Vector<T>&& other) : m_size(other.m_size), m_max(other.m_max), ptr_to_data(other.ptr_to_data) {
+    other.m_size = 0;
+    other.m_max = 0;
     other.ptr_to_data = nullptr;
 }
 
@@ -38,17 +40,32 @@ void Vector<T>::vector_copy(const Vector<T>& source) {
     return;
 }
 
+template <typename T>
+T* Vector<T>::allocate(const int& count) {
+    T* data = new T[count];
+    if (allocation_counter().is_counting()) { allocation_counter().record_allocation(size_t(count) * sizeof(T)); }
+
+    return data;
+}
+
+template <typename T>
+void Vector<T>::release(T* data, const int& count) {
+    if (data == nullptr) { return; }
+    if (allocation_counter().is_counting()) { allocation_counter().record_free(size_t(count) * sizeof(T)); }
+    delete [] data;
+
+    return;
+}
+
 template <typename T>
 Vector<T>::~Vector() {
-    delete [] ptr_to_data;
+    release(ptr_to_data, m_max);
 }
 
 template <typename T>
 Vector<T> Vector<T>::operator-() const {
     Vector<T> temp(*this);
-    for (int i = 0; i < m_size; i++) {
-        temp[i] = -temp[i];
-    }
+    vector_scale(T(-1), temp.get_ptr(), m_size);
 
     return temp;
 }
@@ -79,8 +96,6 @@ Vector<T>& Vector<T>::operator=(const T& val) {
         ptr_to_data[i] = val;
     }
 
-    cout << "test2" << endl;
-
     return *this;
 }
 
@@ -96,9 +111,7 @@ template <typename T>
 Vector<T>& Vector<T>::operator+=(const Vector<T>& v2) {
     if (m_size != v2.get_size()) { throw domain_error("Error: Vectors to be added must be of same size."); }
 
-    for (int i = 0; i < m_size; i++) {
-        ptr_to_data[i] += v2[i];
-    }
+    vector_axpy(T(1), v2.get_ptr(), ptr_to_data, m_size);
 
     return *this;
 }
@@ -115,41 +128,52 @@ template <typename T>
 Vector<T>& Vector<T>::operator-=(const Vector<T>& v2) {
     if (m_size != v2.get_size()) { throw domain_error("Error: Vectors to be subtracted must be of same size."); }
 
-    return (*this += (-v2));
+    vector_axpy(T(-1), v2.get_ptr(), ptr_to_data, m_size);
+
+    return *this;
 }
 
 template <typename T>
 T Vector<T>::operator*(const Vector<T>& v2) const {
     if (m_size != v2.get_size()) { throw domain_error("Error: Vectors dot product is applied must be of same size."); }
-    T dot_product = 0;
 
-    for (int i = 0; i < m_size; i++) {
-        dot_product += ptr_to_data[i] * v2[i];
-    }
-
-    return dot_product;
+    return vector_dot(ptr_to_data, v2.get_ptr(), m_size);
 }
 
 template <typename T>
 Vector<T> Vector<T>::operator*(const T& scalar) const {
     Vector<T> result(*this);
-
-    for (int i = 0; i < m_size; i++) {
-        result[i] *= scalar;
-    }
+    vector_scale(scalar, result.get_ptr(), m_size);
 
     return result;
 }
 
+template <typename T>
+Vector<T>& Vector<T>::axpy(const T& a, const Vector<T>& x) {
+    if (m_size != x.get_size()) { throw domain_error("Error: Vectors to be added must be of same size."); }
+
+    vector_axpy(a, x.get_ptr(), ptr_to_data, m_size);
+
+    return *this;
+}
+
+template <typename T>
+Vector<T>& Vector<T>::axpby(const T& a, const Vector<T>& x, const T& b) {
+    if (m_size != x.get_size()) { throw domain_error("Error: Vectors to be added must be of same size."); }
+
+    vector_axpby(a, x.get_ptr(), b, ptr_to_data, m_size);
+
+    return *this;
+}
+
 template <typename T>
 void Vector<T>::reset_vector(const int& size) {
-    if (size != m_size) {
-        delete [] ptr_to_data;
-        m_size = size;
-        ptr_to_data = new T[size];
+    if (size > m_max || ptr_to_data == nullptr) {
+        release(ptr_to_data, m_max);
+        ptr_to_data = allocate(size * 2);
+        m_max = size * 2;
     }
-
-    m_max = size * 2;
+    m_size = size;
 
     return;
 }
@@ -170,7 +194,7 @@ void Vector<T>::push_back(const T& val) {
     }
     // Container is completely empty
     else if (ptr_to_data == nullptr) {
-        ptr_to_data = new T[DEFAULT_MAX];
+        ptr_to_data = allocate(DEFAULT_MAX);
         ptr_to_data[0] = val;
         m_size++;
         m_max = DEFAULT_MAX;
@@ -178,8 +202,7 @@ void Vector<T>::push_back(const T& val) {
     // Container is full (m_size == m_max)
     else {
         // Create new container
-        m_max *= 2;
-        T* new_ptr_to_data = new T[m_max];
+        T* new_ptr_to_data = allocate(m_max * 2);
 
         // Copy data from old container to new container
         for (int i = 0; i < m_size; i++) {
@@ -189,8 +212,9 @@ void Vector<T>::push_back(const T& val) {
         m_size++;
 
         // Memory housekeeping
-        delete [] ptr_to_data;
+        release(ptr_to_data, m_max);
         ptr_to_data = new_ptr_to_data;
+        m_max *= 2;
     }
 
     return;
@@ -206,12 +230,7 @@ void Vector<T>::pop_back() {
 
 template <typename T>
 T Vector<T>::abs_max_element() const {
-    T result = abs(ptr_to_data[0]);
-    for (int col = 0; col < m_size; col++) {
-        result = (result < abs(ptr_to_data[col])) ? abs(ptr_to_data[col]) : result;
-    }
-
-    return result;
+    return vector_abs_max(ptr_to_data, m_size);
 }
 
 template <typename T>
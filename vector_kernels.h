@@ -0,0 +1,107 @@
+/*! \file
+ *  SIMD kernels for contiguous arrays (dot, axpy, axpby, scale, abs max) used by `Vector`, the
+ *  padded 5-point stencil row used by `Stencil_Operator_2D`, and the interleaved substitution step
+ *  used by the multiple right hand side solves.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+#ifndef VECTOR_KERNELS_H
+#define VECTOR_KERNELS_H
+#include "libraries.h"
+#include <cstdlib>
+#include <cstring>
+#if defined(__GNUC__) && defined(__x86_64__)
+#define VECTOR_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+/*! Environment variable that caps the instruction set of the kernels (scalar, sse2, avx2 or avx512) */
+const char* const SIMD_LEVEL_VARIABLE = "FDS_SIMD";
+
+/*! Instruction sets the float and double kernels are written for */
+enum Simd_Level { simd_scalar, simd_sse2, simd_avx2, simd_avx512 };
+
+/*! Gets the instruction set the kernels run with: the best the CPU supports (CPUID), capped by
+ *  the FDS_SIMD environment variable. Detected once.
+ */
+inline Simd_Level simd_level();
+
+/*! Gets the name of an instruction set level */
+inline string simd_level_name(const Simd_Level& level);
+
+/*! Dot product of x and y
+ *
+ *  \pre x and y hold n elements
+ *  \return sum of x[i] * y[i] (float and double accumulate in vector lanes, so the rounding
+ *          differs from a sequential sum)
+ */
+template <typename T>
+T vector_dot(const T* x, const T* y, const int n);
+inline double vector_dot(const double* x, const double* y, const int n);
+inline float vector_dot(const float* x, const float* y, const int n);
+
+/*! y = y + a * x (rounded exactly like the scalar loop)
+ *
+ *  \pre x and y hold n elements
+ */
+template <typename T>
+void vector_axpy(const T a, const T* x, T* y, const int n);
+inline void vector_axpy(const double a, const double* x, double* y, const int n);
+inline void vector_axpy(const float a, const float* x, float* y, const int n);
+
+/*! y = a * x + b * y (rounded exactly like the scalar loop)
+ *
+ *  \pre x and y hold n elements
+ */
+template <typename T>
+void vector_axpby(const T a, const T* x, const T b, T* y, const int n);
+inline void vector_axpby(const double a, const double* x, const double b, double* y, const int n);
+inline void vector_axpby(const float a, const float* x, const float b, float* y, const int n);
+
+/*! x = a * x
+ *
+ *  \pre x holds n elements
+ */
+template <typename T>
+void vector_scale(const T a, T* x, const int n);
+inline void vector_scale(const double a, double* x, const int n);
+inline void vector_scale(const float a, float* x, const int n);
+
+/*! Largest absolute value in x
+ *
+ *  \pre x holds n elements
+ *  \return max |x[i]| (0 if n == 0)
+ */
+template <typename T>
+T vector_abs_max(const T* x, const int n);
+inline double vector_abs_max(const double* x, const int n);
+inline float vector_abs_max(const float* x, const int n);
+
+/*! One row of the 5-point stencil on a padded grid: out[i] = row[i] - (row[i - 1] + row[i + 1] + previous[i] + next[i]) / 4.
+ *  The neighbours outside the row (row[-1], row[n]) are the ghost cells, so the loop has no branches.
+ *
+ *  \pre previous, next and out hold n elements; row holds n + 2 elements starting at row - 1
+ *  \post out holds the stencil of every point of the row (rounded like the scalar loop)
+ */
+template <typename T>
+void vector_stencil_5pt(const T* previous, const T* row, const T* next, T* out, const int n);
+inline void vector_stencil_5pt(const double* previous, const double* row, const double* next, double* out, const int n);
+inline void vector_stencil_5pt(const float* previous, const float* row, const float* next, float* out, const int n);
+
+/*! One step of a substitution on `lanes` right hand sides stored interleaved (element i of right hand
+ *  side l at solved[i * lanes + l]): sum[l] -= coefficients[c] * solved[c * lanes + l] for every c < count.
+ *  Each scalar step runs across all lanes at once, as one vector instruction when lanes fills the registers.
+ *
+ *  \pre coefficients holds count elements, solved holds count * lanes elements and sum holds lanes elements
+ *  \post sum is updated (rounded like the scalar loop, in the same order)
+ */
+template <int lanes, typename T>
+void vector_interleaved_update(const T* coefficients, const int count, const T* solved, T* sum);
+template <int lanes>
+inline void vector_interleaved_update(const double* coefficients, const int count, const double* solved, double* sum);
+template <int lanes>
+inline void vector_interleaved_update(const float* coefficients, const int count, const float* solved, float* sum);
+
+#include "vector_kernels.hpp"
+#endif
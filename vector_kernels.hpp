@@ -0,0 +1,868 @@
+/*! \file
+ *  Definitions of the kernels declared in vector_kernels.h: a scalar template for every type, and
+ *  SSE2, AVX2 and AVX-512 versions for float and double selected at runtime.
+ */
+
+//Programmers: Zachary Bahr and Jacob LeGrand
+
+inline Simd_Level simd_level() {
+    // Detected on first use (thread-safe static initialization)
+    static const Simd_Level level = [] {
+        Simd_Level supported = simd_scalar;
+#ifdef VECTOR_KERNELS_X86
+        __builtin_cpu_init();
+        supported = simd_sse2;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) { supported = simd_avx2; }
+        if (__builtin_cpu_supports("avx512f")) { supported = simd_avx512; }
+#endif
+        const char* cap = getenv(SIMD_LEVEL_VARIABLE);
+        if (cap != nullptr) {
+            for (int l = simd_scalar; l <= simd_avx512; l++) {
+                if (simd_level_name(Simd_Level(l)) == cap && l < supported) { supported = Simd_Level(l); }
+            }
+        }
+
+        return supported;
+    }();
+
+    return level;
+}
+
+inline string simd_level_name(const Simd_Level& level) {
+    switch (level) {
+        case simd_sse2: return "sse2";
+        case simd_avx2: return "avx2";
+        case simd_avx512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+////////////////////////////////////////// Scalar //////////////////////////////////////////
+template <typename T>
+T vector_dot(const T* x, const T* y, const int n) {
+    T sum = 0;
+    for (int i = 0; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+template <typename T>
+void vector_axpy(const T a, const T* x, T* y, const int n) {
+    for (int i = 0; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+template <typename T>
+void vector_axpby(const T a, const T* x, const T b, T* y, const int n) {
+    for (int i = 0; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+template <typename T>
+void vector_scale(const T a, T* x, const int n) {
+    for (int i = 0; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+template <typename T>
+void vector_stencil_5pt(const T* previous, const T* row, const T* next, T* out, const int n) {
+    for (int i = 0; i < n; i++) { out[i] = row[i] - T(0.25) * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+template <typename T>
+T vector_abs_max(const T* x, const int n) {
+    T result = 0;
+    for (int i = 0; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+template <int lanes, typename T>
+void vector_interleaved_update(const T* coefficients, const int count, const T* solved, T* sum) {
+    for (int c = 0; c < count; c++) {
+        const T factor = coefficients[c];
+        for (int l = 0; l < lanes; l++) { sum[l] -= factor * solved[c * lanes + l]; }
+    }
+
+    return;
+}
+
+#ifdef VECTOR_KERNELS_X86
+// Elementwise kernels multiply and add separately (no FMA, and no contraction into one) so they round
+// exactly like the scalar loops
+/////////////////////////////////////////// SSE2 ///////////////////////////////////////////
+inline void stencil_5pt_sse2(const double* previous, const double* row, const double* next, double* out, const int n) {
+    const __m128d quarter = _mm_set1_pd(0.25);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d sum = _mm_add_pd(_mm_loadu_pd(row + i - 1), _mm_loadu_pd(row + i + 1));
+        sum = _mm_add_pd(_mm_add_pd(sum, _mm_loadu_pd(previous + i)), _mm_loadu_pd(next + i));
+        _mm_storeu_pd(out + i, _mm_sub_pd(_mm_loadu_pd(row + i), _mm_mul_pd(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25 * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline void stencil_5pt_sse2(const float* previous, const float* row, const float* next, float* out, const int n) {
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(row + i - 1), _mm_loadu_ps(row + i + 1));
+        sum = _mm_add_ps(_mm_add_ps(sum, _mm_loadu_ps(previous + i)), _mm_loadu_ps(next + i));
+        _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(row + i), _mm_mul_ps(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25f * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline double dot_sse2(const double* x, const double* y, const int n) {
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_loadu_pd(x + i + 2), _mm_loadu_pd(y + i + 2)));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    double sum = 0;
+    for (int l = 0; l < 2; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline void axpy_sse2(const double a, const double* x, double* y, const int n) {
+    const __m128d scale = _mm_set1_pd(a);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(scale, _mm_loadu_pd(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline void axpby_sse2(const double a, const double* x, const double b, double* y, const int n) {
+    const __m128d scale_x = _mm_set1_pd(a);
+    const __m128d scale_y = _mm_set1_pd(b);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_mul_pd(scale_x, _mm_loadu_pd(x + i)), _mm_mul_pd(scale_y, _mm_loadu_pd(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline void scale_sse2(const double a, double* x, const int n) {
+    const __m128d scale = _mm_set1_pd(a);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(x + i, _mm_mul_pd(scale, _mm_loadu_pd(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+inline double abs_max_sse2(const double* x, const int n) {
+    const __m128d sign = _mm_set1_pd(-0.0);
+    __m128d max0 = _mm_setzero_pd();
+    __m128d max1 = _mm_setzero_pd();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        max0 = _mm_max_pd(max0, _mm_andnot_pd(sign, _mm_loadu_pd(x + i)));
+        max1 = _mm_max_pd(max1, _mm_andnot_pd(sign, _mm_loadu_pd(x + i + 2)));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_max_pd(max0, max1));
+    double result = 0;
+    for (int l = 0; l < 2; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+inline float dot_sse2(const float* x, const float* y, const int n) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(y + i + 4)));
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, _mm_add_ps(sum0, sum1));
+    float sum = 0;
+    for (int l = 0; l < 4; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline void axpy_sse2(const float a, const float* x, float* y, const int n) {
+    const __m128 scale = _mm_set1_ps(a);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(scale, _mm_loadu_ps(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline void axpby_sse2(const float a, const float* x, const float b, float* y, const int n) {
+    const __m128 scale_x = _mm_set1_ps(a);
+    const __m128 scale_y = _mm_set1_ps(b);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_mul_ps(scale_x, _mm_loadu_ps(x + i)), _mm_mul_ps(scale_y, _mm_loadu_ps(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline void scale_sse2(const float a, float* x, const int n) {
+    const __m128 scale = _mm_set1_ps(a);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(x + i, _mm_mul_ps(scale, _mm_loadu_ps(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+inline float abs_max_sse2(const float* x, const int n) {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 max0 = _mm_setzero_ps();
+    __m128 max1 = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        max0 = _mm_max_ps(max0, _mm_andnot_ps(sign, _mm_loadu_ps(x + i)));
+        max1 = _mm_max_ps(max1, _mm_andnot_ps(sign, _mm_loadu_ps(x + i + 4)));
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, _mm_max_ps(max0, max1));
+    float result = 0;
+    for (int l = 0; l < 4; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+template <int lanes>
+inline void interleaved_update_sse2(const double* coefficients, const int count, const double* solved, double* sum) {
+    // One accumulator register per 2 lanes, kept across the whole row
+    __m128d accumulator[(lanes / 2 > 0) ? lanes / 2 : 1];
+    for (int k = 0; k < lanes / 2; k++) { accumulator[k] = _mm_loadu_pd(sum + 2 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m128d factor = _mm_set1_pd(coefficients[c]);
+        for (int k = 0; k < lanes / 2; k++) {
+            accumulator[k] = _mm_sub_pd(accumulator[k], _mm_mul_pd(factor, _mm_loadu_pd(solved + c * lanes + 2 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 2; k++) { _mm_storeu_pd(sum + 2 * k, accumulator[k]); }
+
+    return;
+}
+
+template <int lanes>
+inline void interleaved_update_sse2(const float* coefficients, const int count, const float* solved, float* sum) {
+    // One accumulator register per 4 lanes, kept across the whole row
+    __m128 accumulator[(lanes / 4 > 0) ? lanes / 4 : 1];
+    for (int k = 0; k < lanes / 4; k++) { accumulator[k] = _mm_loadu_ps(sum + 4 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m128 factor = _mm_set1_ps(coefficients[c]);
+        for (int k = 0; k < lanes / 4; k++) {
+            accumulator[k] = _mm_sub_ps(accumulator[k], _mm_mul_ps(factor, _mm_loadu_ps(solved + c * lanes + 4 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 4; k++) { _mm_storeu_ps(sum + 4 * k, accumulator[k]); }
+
+    return;
+}
+
+/////////////////////////////////////////// AVX2 ///////////////////////////////////////////
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void stencil_5pt_avx2(const double* previous, const double* row, const double* next, double* out, const int n) {
+    const __m256d quarter = _mm256_set1_pd(0.25);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d sum = _mm256_add_pd(_mm256_loadu_pd(row + i - 1), _mm256_loadu_pd(row + i + 1));
+        sum = _mm256_add_pd(_mm256_add_pd(sum, _mm256_loadu_pd(previous + i)), _mm256_loadu_pd(next + i));
+        _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(row + i), _mm256_mul_pd(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25 * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void stencil_5pt_avx2(const float* previous, const float* row, const float* next, float* out, const int n) {
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 sum = _mm256_add_ps(_mm256_loadu_ps(row + i - 1), _mm256_loadu_ps(row + i + 1));
+        sum = _mm256_add_ps(_mm256_add_ps(sum, _mm256_loadu_ps(previous + i)), _mm256_loadu_ps(next + i));
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(row + i), _mm256_mul_ps(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25f * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline __attribute__((target("avx2,fma"))) double dot_avx2(const double* x, const double* y, const int n) {
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), sum1);
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+    double sum = 0;
+    for (int l = 0; l < 4; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void axpy_avx2(const double a, const double* x, double* y, const int n) {
+    const __m256d scale = _mm256_set1_pd(a);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(scale, _mm256_loadu_pd(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void axpby_avx2(const double a, const double* x, const double b, double* y, const int n) {
+    const __m256d scale_x = _mm256_set1_pd(a);
+    const __m256d scale_y = _mm256_set1_pd(b);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_mul_pd(scale_x, _mm256_loadu_pd(x + i)), _mm256_mul_pd(scale_y, _mm256_loadu_pd(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void scale_avx2(const double a, double* x, const int n) {
+    const __m256d scale = _mm256_set1_pd(a);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(x + i, _mm256_mul_pd(scale, _mm256_loadu_pd(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+inline __attribute__((target("avx2,fma"))) double abs_max_avx2(const double* x, const int n) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d max0 = _mm256_setzero_pd();
+    __m256d max1 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        max0 = _mm256_max_pd(max0, _mm256_andnot_pd(sign, _mm256_loadu_pd(x + i)));
+        max1 = _mm256_max_pd(max1, _mm256_andnot_pd(sign, _mm256_loadu_pd(x + i + 4)));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_max_pd(max0, max1));
+    double result = 0;
+    for (int l = 0; l < 4; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+inline __attribute__((target("avx2,fma"))) float dot_avx2(const float* x, const float* y, const int n) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8), sum1);
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(sum0, sum1));
+    float sum = 0;
+    for (int l = 0; l < 8; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void axpy_avx2(const float a, const float* x, float* y, const int n) {
+    const __m256 scale = _mm256_set1_ps(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(scale, _mm256_loadu_ps(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void axpby_avx2(const float a, const float* x, const float b, float* y, const int n) {
+    const __m256 scale_x = _mm256_set1_ps(a);
+    const __m256 scale_y = _mm256_set1_ps(b);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_mul_ps(scale_x, _mm256_loadu_ps(x + i)), _mm256_mul_ps(scale_y, _mm256_loadu_ps(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void scale_avx2(const float a, float* x, const int n) {
+    const __m256 scale = _mm256_set1_ps(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(x + i, _mm256_mul_ps(scale, _mm256_loadu_ps(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+inline __attribute__((target("avx2,fma"))) float abs_max_avx2(const float* x, const int n) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 max0 = _mm256_setzero_ps();
+    __m256 max1 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        max0 = _mm256_max_ps(max0, _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i)));
+        max1 = _mm256_max_ps(max1, _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i + 8)));
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_max_ps(max0, max1));
+    float result = 0;
+    for (int l = 0; l < 8; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+template <int lanes>
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void interleaved_update_avx2(const double* coefficients, const int count, const double* solved, double* sum) {
+    // One accumulator register per 4 lanes, kept across the whole row
+    __m256d accumulator[(lanes / 4 > 0) ? lanes / 4 : 1];
+    for (int k = 0; k < lanes / 4; k++) { accumulator[k] = _mm256_loadu_pd(sum + 4 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m256d factor = _mm256_set1_pd(coefficients[c]);
+        for (int k = 0; k < lanes / 4; k++) {
+            accumulator[k] = _mm256_sub_pd(accumulator[k], _mm256_mul_pd(factor, _mm256_loadu_pd(solved + c * lanes + 4 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 4; k++) { _mm256_storeu_pd(sum + 4 * k, accumulator[k]); }
+
+    return;
+}
+
+template <int lanes>
+inline __attribute__((target("avx2"), optimize("fp-contract=off"))) void interleaved_update_avx2(const float* coefficients, const int count, const float* solved, float* sum) {
+    // One accumulator register per 8 lanes, kept across the whole row
+    __m256 accumulator[(lanes / 8 > 0) ? lanes / 8 : 1];
+    for (int k = 0; k < lanes / 8; k++) { accumulator[k] = _mm256_loadu_ps(sum + 8 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m256 factor = _mm256_set1_ps(coefficients[c]);
+        for (int k = 0; k < lanes / 8; k++) {
+            accumulator[k] = _mm256_sub_ps(accumulator[k], _mm256_mul_ps(factor, _mm256_loadu_ps(solved + c * lanes + 8 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 8; k++) { _mm256_storeu_ps(sum + 8 * k, accumulator[k]); }
+
+    return;
+}
+
+/////////////////////////////////////////// AVX512 ///////////////////////////////////////////
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void stencil_5pt_avx512(const double* previous, const double* row, const double* next, double* out, const int n) {
+    const __m512d quarter = _mm512_set1_pd(0.25);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d sum = _mm512_add_pd(_mm512_loadu_pd(row + i - 1), _mm512_loadu_pd(row + i + 1));
+        sum = _mm512_add_pd(_mm512_add_pd(sum, _mm512_loadu_pd(previous + i)), _mm512_loadu_pd(next + i));
+        _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(row + i), _mm512_mul_pd(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25 * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void stencil_5pt_avx512(const float* previous, const float* row, const float* next, float* out, const int n) {
+    const __m512 quarter = _mm512_set1_ps(0.25f);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 sum = _mm512_add_ps(_mm512_loadu_ps(row + i - 1), _mm512_loadu_ps(row + i + 1));
+        sum = _mm512_add_ps(_mm512_add_ps(sum, _mm512_loadu_ps(previous + i)), _mm512_loadu_ps(next + i));
+        _mm512_storeu_ps(out + i, _mm512_sub_ps(_mm512_loadu_ps(row + i), _mm512_mul_ps(quarter, sum)));
+    }
+    for (; i < n; i++) { out[i] = row[i] - 0.25f * (((row[i - 1] + row[i + 1]) + previous[i]) + next[i]); }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"))) double dot_avx512(const double* x, const double* y, const int n) {
+    __m512d sum0 = _mm512_setzero_pd();
+    __m512d sum1 = _mm512_setzero_pd();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), sum0);
+        sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8), sum1);
+    }
+
+    double lanes[8];
+    _mm512_storeu_pd(lanes, _mm512_add_pd(sum0, sum1));
+    double sum = 0;
+    for (int l = 0; l < 8; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void axpy_avx512(const double a, const double* x, double* y, const int n) {
+    const __m512d scale = _mm512_set1_pd(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, _mm512_add_pd(_mm512_loadu_pd(y + i), _mm512_mul_pd(scale, _mm512_loadu_pd(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void axpby_avx512(const double a, const double* x, const double b, double* y, const int n) {
+    const __m512d scale_x = _mm512_set1_pd(a);
+    const __m512d scale_y = _mm512_set1_pd(b);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, _mm512_add_pd(_mm512_mul_pd(scale_x, _mm512_loadu_pd(x + i)), _mm512_mul_pd(scale_y, _mm512_loadu_pd(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void scale_avx512(const double a, double* x, const int n) {
+    const __m512d scale = _mm512_set1_pd(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(x + i, _mm512_mul_pd(scale, _mm512_loadu_pd(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+// The all-lanes masked max avoids the uninitialized source operand of _mm512_max_* in some GCC headers
+inline __attribute__((target("avx512f"))) double abs_max_avx512(const double* x, const int n) {
+    __m512d max0 = _mm512_setzero_pd();
+    __m512d max1 = _mm512_setzero_pd();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        max0 = _mm512_maskz_max_pd(__mmask8(-1), max0, _mm512_abs_pd(_mm512_loadu_pd(x + i)));
+        max1 = _mm512_maskz_max_pd(__mmask8(-1), max1, _mm512_abs_pd(_mm512_loadu_pd(x + i + 8)));
+    }
+
+    double lanes[8];
+    _mm512_storeu_pd(lanes, _mm512_maskz_max_pd(__mmask8(-1), max0, max1));
+    double result = 0;
+    for (int l = 0; l < 8; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+
+inline __attribute__((target("avx512f"))) float dot_avx512(const float* x, const float* y, const int n) {
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 16), _mm512_loadu_ps(y + i + 16), sum1);
+    }
+
+    float lanes[16];
+    _mm512_storeu_ps(lanes, _mm512_add_ps(sum0, sum1));
+    float sum = 0;
+    for (int l = 0; l < 16; l++) { sum += lanes[l]; }
+    for (; i < n; i++) { sum += x[i] * y[i]; }
+
+    return sum;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void axpy_avx512(const float a, const float* x, float* y, const int n) {
+    const __m512 scale = _mm512_set1_ps(a);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_add_ps(_mm512_loadu_ps(y + i), _mm512_mul_ps(scale, _mm512_loadu_ps(x + i))));
+    }
+    for (; i < n; i++) { y[i] += a * x[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void axpby_avx512(const float a, const float* x, const float b, float* y, const int n) {
+    const __m512 scale_x = _mm512_set1_ps(a);
+    const __m512 scale_y = _mm512_set1_ps(b);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_add_ps(_mm512_mul_ps(scale_x, _mm512_loadu_ps(x + i)), _mm512_mul_ps(scale_y, _mm512_loadu_ps(y + i))));
+    }
+    for (; i < n; i++) { y[i] = a * x[i] + b * y[i]; }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void scale_avx512(const float a, float* x, const int n) {
+    const __m512 scale = _mm512_set1_ps(a);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(x + i, _mm512_mul_ps(scale, _mm512_loadu_ps(x + i)));
+    }
+    for (; i < n; i++) { x[i] *= a; }
+
+    return;
+}
+
+inline __attribute__((target("avx512f"))) float abs_max_avx512(const float* x, const int n) {
+    __m512 max0 = _mm512_setzero_ps();
+    __m512 max1 = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        max0 = _mm512_maskz_max_ps(__mmask16(-1), max0, _mm512_abs_ps(_mm512_loadu_ps(x + i)));
+        max1 = _mm512_maskz_max_ps(__mmask16(-1), max1, _mm512_abs_ps(_mm512_loadu_ps(x + i + 16)));
+    }
+
+    float lanes[16];
+    _mm512_storeu_ps(lanes, _mm512_maskz_max_ps(__mmask16(-1), max0, max1));
+    float result = 0;
+    for (int l = 0; l < 16; l++) { result = (result < lanes[l]) ? lanes[l] : result; }
+    for (; i < n; i++) { result = (result < abs(x[i])) ? abs(x[i]) : result; }
+
+    return result;
+}
+template <int lanes>
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void interleaved_update_avx512(const double* coefficients, const int count, const double* solved, double* sum) {
+    // One accumulator register per 8 lanes, kept across the whole row
+    __m512d accumulator[(lanes / 8 > 0) ? lanes / 8 : 1];
+    for (int k = 0; k < lanes / 8; k++) { accumulator[k] = _mm512_loadu_pd(sum + 8 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m512d factor = _mm512_set1_pd(coefficients[c]);
+        for (int k = 0; k < lanes / 8; k++) {
+            accumulator[k] = _mm512_sub_pd(accumulator[k], _mm512_mul_pd(factor, _mm512_loadu_pd(solved + c * lanes + 8 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 8; k++) { _mm512_storeu_pd(sum + 8 * k, accumulator[k]); }
+
+    return;
+}
+
+template <int lanes>
+inline __attribute__((target("avx512f"), optimize("fp-contract=off"))) void interleaved_update_avx512(const float* coefficients, const int count, const float* solved, float* sum) {
+    // One accumulator register per 16 lanes, kept across the whole row
+    __m512 accumulator[(lanes / 16 > 0) ? lanes / 16 : 1];
+    for (int k = 0; k < lanes / 16; k++) { accumulator[k] = _mm512_loadu_ps(sum + 16 * k); }
+    for (int c = 0; c < count; c++) {
+        const __m512 factor = _mm512_set1_ps(coefficients[c]);
+        for (int k = 0; k < lanes / 16; k++) {
+            accumulator[k] = _mm512_sub_ps(accumulator[k], _mm512_mul_ps(factor, _mm512_loadu_ps(solved + c * lanes + 16 * k)));
+        }
+    }
+    for (int k = 0; k < lanes / 16; k++) { _mm512_storeu_ps(sum + 16 * k, accumulator[k]); }
+
+    return;
+}
+
+#endif
+
+///////////////////////////////////////// Dispatch /////////////////////////////////////////
+inline double vector_dot(const double* x, const double* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: return dot_avx512(x, y, n);
+        case simd_avx2: return dot_avx2(x, y, n);
+        case simd_sse2: return dot_sse2(x, y, n);
+        default: break;
+    }
+#endif
+    return vector_dot<double>(x, y, n);
+}
+
+inline void vector_axpy(const double a, const double* x, double* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: axpy_avx512(a, x, y, n); return;
+        case simd_avx2: axpy_avx2(a, x, y, n); return;
+        case simd_sse2: axpy_sse2(a, x, y, n); return;
+        default: break;
+    }
+#endif
+    vector_axpy<double>(a, x, y, n);
+}
+
+inline void vector_axpby(const double a, const double* x, const double b, double* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: axpby_avx512(a, x, b, y, n); return;
+        case simd_avx2: axpby_avx2(a, x, b, y, n); return;
+        case simd_sse2: axpby_sse2(a, x, b, y, n); return;
+        default: break;
+    }
+#endif
+    vector_axpby<double>(a, x, b, y, n);
+}
+
+inline void vector_scale(const double a, double* x, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: scale_avx512(a, x, n); return;
+        case simd_avx2: scale_avx2(a, x, n); return;
+        case simd_sse2: scale_sse2(a, x, n); return;
+        default: break;
+    }
+#endif
+    vector_scale<double>(a, x, n);
+}
+
+inline double vector_abs_max(const double* x, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: return abs_max_avx512(x, n);
+        case simd_avx2: return abs_max_avx2(x, n);
+        case simd_sse2: return abs_max_sse2(x, n);
+        default: break;
+    }
+#endif
+    return vector_abs_max<double>(x, n);
+}
+
+inline float vector_dot(const float* x, const float* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: return dot_avx512(x, y, n);
+        case simd_avx2: return dot_avx2(x, y, n);
+        case simd_sse2: return dot_sse2(x, y, n);
+        default: break;
+    }
+#endif
+    return vector_dot<float>(x, y, n);
+}
+
+inline void vector_axpy(const float a, const float* x, float* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: axpy_avx512(a, x, y, n); return;
+        case simd_avx2: axpy_avx2(a, x, y, n); return;
+        case simd_sse2: axpy_sse2(a, x, y, n); return;
+        default: break;
+    }
+#endif
+    vector_axpy<float>(a, x, y, n);
+}
+
+inline void vector_axpby(const float a, const float* x, const float b, float* y, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: axpby_avx512(a, x, b, y, n); return;
+        case simd_avx2: axpby_avx2(a, x, b, y, n); return;
+        case simd_sse2: axpby_sse2(a, x, b, y, n); return;
+        default: break;
+    }
+#endif
+    vector_axpby<float>(a, x, b, y, n);
+}
+
+inline void vector_scale(const float a, float* x, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: scale_avx512(a, x, n); return;
+        case simd_avx2: scale_avx2(a, x, n); return;
+        case simd_sse2: scale_sse2(a, x, n); return;
+        default: break;
+    }
+#endif
+    vector_scale<float>(a, x, n);
+}
+
+inline float vector_abs_max(const float* x, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: return abs_max_avx512(x, n);
+        case simd_avx2: return abs_max_avx2(x, n);
+        case simd_sse2: return abs_max_sse2(x, n);
+        default: break;
+    }
+#endif
+    return vector_abs_max<float>(x, n);
+}
+
+inline void vector_stencil_5pt(const double* previous, const double* row, const double* next, double* out, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: stencil_5pt_avx512(previous, row, next, out, n); return;
+        case simd_avx2: stencil_5pt_avx2(previous, row, next, out, n); return;
+        case simd_sse2: stencil_5pt_sse2(previous, row, next, out, n); return;
+        default: break;
+    }
+#endif
+    vector_stencil_5pt<double>(previous, row, next, out, n);
+}
+
+inline void vector_stencil_5pt(const float* previous, const float* row, const float* next, float* out, const int n) {
+#ifdef VECTOR_KERNELS_X86
+    switch (simd_level()) {
+        case simd_avx512: stencil_5pt_avx512(previous, row, next, out, n); return;
+        case simd_avx2: stencil_5pt_avx2(previous, row, next, out, n); return;
+        case simd_sse2: stencil_5pt_sse2(previous, row, next, out, n); return;
+        default: break;
+    }
+#endif
+    vector_stencil_5pt<float>(previous, row, next, out, n);
+}
+
+template <int lanes>
+inline void vector_interleaved_update(const double* coefficients, const int count, const double* solved, double* sum) {
+#ifdef VECTOR_KERNELS_X86
+    // The widest registers lanes fills exactly
+    const Simd_Level level = simd_level();
+    if (level >= simd_avx512 && lanes % 8 == 0) { interleaved_update_avx512<lanes>(coefficients, count, solved, sum); return; }
+    if (level >= simd_avx2 && lanes % 4 == 0) { interleaved_update_avx2<lanes>(coefficients, count, solved, sum); return; }
+    if (level >= simd_sse2 && lanes % 2 == 0) { interleaved_update_sse2<lanes>(coefficients, count, solved, sum); return; }
+#endif
+    vector_interleaved_update<lanes, double>(coefficients, count, solved, sum);
+}
+
+template <int lanes>
+inline void vector_interleaved_update(const float* coefficients, const int count, const float* solved, float* sum) {
+#ifdef VECTOR_KERNELS_X86
+    // The widest registers lanes fills exactly
+    const Simd_Level level = simd_level();
+    if (level >= simd_avx512 && lanes % 16 == 0) { interleaved_update_avx512<lanes>(coefficients, count, solved, sum); return; }
+    if (level >= simd_avx2 && lanes % 8 == 0) { interleaved_update_avx2<lanes>(coefficients, count, solved, sum); return; }
+    if (level >= simd_sse2 && lanes % 4 == 0) { interleaved_update_sse2<lanes>(coefficients, count, solved, sum); return; }
+#endif
+    vector_interleaved_update<lanes, float>(coefficients, count, solved, sum);
+}